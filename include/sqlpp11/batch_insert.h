@@ -0,0 +1,291 @@
+#pragma once
+
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <sqlpp11/data_types/no_value.h>
+#include <sqlpp11/detail/index_sequence.h>
+#include <sqlpp11/exception.h>
+#include <sqlpp11/insert_value.h>
+#include <sqlpp11/interpret_tuple.h>
+#include <sqlpp11/logic.h>
+#include <sqlpp11/parameter.h>
+#include <sqlpp11/portable_static_assert.h>
+#include <sqlpp11/type_traits.h>
+
+namespace sqlpp
+{
+  template <typename Db, typename Statement, typename... Columns>
+  struct prepared_batch_insert_t;
+
+  SQLPP_PORTABLE_STATIC_ASSERT(assert_batch_insert_is_prepared_t,
+                               "batch inserts have to be prepared, e.g. db.prepare(insert_into(t).columns(...).batch(n))");
+
+  // INSERT INTO ... (columns...) VALUES (?,...),(?,...),... with parameters for a fixed number of rows.
+  // Created by insert_into(t).columns(...).batch(rows) and meant to be prepared, see prepared_batch_insert_t.
+  template <typename Statement, typename... Columns>
+  struct batch_insert_t
+  {
+    using _traits = make_traits<no_value_t, tag::is_statement>;
+    using _nodes = detail::type_vector<>;
+
+    using _run_check = assert_batch_insert_is_prepared_t;
+    using _prepare_check = typename Statement::_prepare_check;
+
+    batch_insert_t(Statement statement, size_t rows) : _statement(statement), _rows(rows)
+    {
+      if (_rows == 0)
+      {
+        throw sqlpp::exception{"batch insert requires at least one row"};
+      }
+    }
+
+    batch_insert_t(const batch_insert_t&) = default;
+    batch_insert_t(batch_insert_t&&) = default;
+    batch_insert_t& operator=(const batch_insert_t&) = default;
+    batch_insert_t& operator=(batch_insert_t&&) = default;
+    ~batch_insert_t() = default;
+
+    template <typename Db>
+    auto _prepare(Db& db) const -> prepared_batch_insert_t<Db, Statement, Columns...>
+    {
+      _prepare_check::verify();
+      return {*this, db.prepare_insert(*this)};
+    }
+
+    size_t _get_no_of_parameters() const
+    {
+      return _rows * sizeof...(Columns);
+    }
+
+    Statement _statement;
+    size_t _rows;
+  };
+
+  template <typename Context, typename Statement, typename... Columns>
+  Context& serialize(const batch_insert_t<Statement, Columns...>& t, Context& context)
+  {
+    serialize(t._statement, context);
+    context << " VALUES ";
+    for (size_t row = 0; row < t._rows; ++row)
+    {
+      if (row)
+      {
+        context << ',';
+      }
+      context << '(';
+      interpret_tuple(std::tuple<parameter_t<value_type_of<Columns>, Columns>...>{}, ",", context);
+      context << ')';
+    }
+    return context;
+  }
+
+  namespace detail
+  {
+    // The rows of one execution of a prepared batch insert, handed to the connector's run_prepared_insert()
+    template <typename PreparedStatement, typename Row>
+    struct batch_insert_chunk_t
+    {
+      PreparedStatement& _prepared_statement;
+      const Row* _rows;
+      size_t _no_of_rows;
+
+      void _bind_params() const
+      {
+        for (size_t row = 0; row < _no_of_rows; ++row)
+        {
+          _bind_row(_rows[row], row * std::tuple_size<Row>::value,
+                    detail::make_index_sequence<std::tuple_size<Row>::value>{});
+        }
+      }
+
+    private:
+      template <size_t... Is>
+      void _bind_row(const Row& row, size_t offset, const detail::index_sequence<Is...>& /*unused*/) const
+      {
+        using swallow = int[];  // see interpret_tuple.h
+        (void)swallow{0, (std::get<Is>(row)._bind(_prepared_statement, offset + Is), 0)...};
+      }
+    };
+  }  // namespace detail
+
+  // Collects rows via add() and inserts them with as few executions as possible when run, e.g.
+  //
+  //   auto batch = db.prepare(insert_into(tab).columns(tab.alpha, tab.beta).batch(100));
+  //   for (...)
+  //     batch.add(tab.alpha = alpha, tab.beta = beta);
+  //   db(batch);
+  //
+  // Running the batch inserts all collected rows, `rows` at a time. Remaining rows are inserted by a second
+  // statement, which is prepared for the number of remaining rows when needed.
+  template <typename Db, typename Statement, typename... Columns>
+  struct prepared_batch_insert_t
+  {
+    using _traits = make_traits<no_value_t, tag::is_prepared_statement>;
+    using _nodes = detail::type_vector<>;
+
+    using _prepared_statement_t = typename Db::_prepared_statement_t;
+    using _row_t = std::tuple<parameter_value_t<value_type_of<Columns>>...>;
+
+    using _run_check = consistent_t;
+
+    prepared_batch_insert_t(batch_insert_t<Statement, Columns...> batch, _prepared_statement_t&& prepared_statement)
+        : _batch(std::move(batch)), _prepared_statement(std::move(prepared_statement))
+    {
+    }
+
+    prepared_batch_insert_t(const prepared_batch_insert_t&) = delete;
+    prepared_batch_insert_t(prepared_batch_insert_t&&) = default;
+    prepared_batch_insert_t& operator=(const prepared_batch_insert_t&) = delete;
+    prepared_batch_insert_t& operator=(prepared_batch_insert_t&&) = default;
+    ~prepared_batch_insert_t() = default;
+
+    //! add a row, like with insert_into(t).columns(...).values.add(...), e.g. add(t.alpha = 17, t.beta = sqlpp::null)
+    template <typename... Assignments>
+    void add(Assignments... assignments)
+    {
+      static_assert(logic::all_t<is_assignment_t<Assignments>::value...>::value, "add() arguments have to be assignments");
+      using _arg_value_tuple = std::tuple<insert_value_t<lhs_t<Assignments>>...>;
+      using _args_correct = std::is_same<_arg_value_tuple, std::tuple<insert_value_t<Columns>...>>;
+      static_assert(_args_correct::value, "add() arguments do not match columns() arguments");
+
+      using ok = logic::all_t<logic::all_t<is_assignment_t<Assignments>::value...>::value, _args_correct::value>;
+
+      _add_impl(ok(), assignments...);  // dispatch to prevent compile messages after the static_assert
+    }
+
+    //! number of rows waiting to be inserted
+    size_t size() const
+    {
+      return _rows.size();
+    }
+
+    //! number of rows inserted per execution
+    size_t batch_size() const
+    {
+      return _batch._rows;
+    }
+
+    void clear()
+    {
+      _rows.clear();
+    }
+
+    //! inserts all collected rows and returns their number.
+    //! If an execution fails, the rows of the preceding executions are removed and the others are kept.
+    auto _run(Db& db) -> size_t
+    {
+      const size_t total = _rows.size();
+      const size_t batch_rows = _batch._rows;
+      size_t done = 0;
+      try
+      {
+        for (; total - done >= batch_rows; done += batch_rows)
+        {
+          db.run_prepared_insert(_chunk(_prepared_statement, done, batch_rows));
+        }
+        if (done < total)
+        {
+          const size_t remaining = total - done;
+          if (not _tail_statement or _tail_rows != remaining)
+          {
+            _tail_statement.reset();  // release the old statement before preparing the new one
+            const auto tail = batch_insert_t<Statement, Columns...>{_batch._statement, remaining};
+            _tail_statement.reset(new _prepared_statement_t(db.prepare_insert(tail)));
+            _tail_rows = remaining;
+          }
+          db.run_prepared_insert(_chunk(*_tail_statement, done, remaining));
+        }
+      }
+      catch (...)
+      {
+        // Running the batch again must not insert these rows twice
+        _rows.erase(_rows.begin(), _rows.begin() + static_cast<std::ptrdiff_t>(done));
+        throw;
+      }
+      _rows.clear();
+      return total;
+    }
+
+  private:
+    template <typename... Assignments>
+    void _add_impl(const std::true_type& /*unused*/, Assignments... assignments)
+    {
+      _add_values(insert_value_t<lhs_t<Assignments>>{assignments._rhs}...);
+    }
+
+    template <typename... Assignments>
+    void _add_impl(const std::false_type&, Assignments... assignments);
+
+    template <typename... InsertValues>
+    void _add_values(const InsertValues&... values)
+    {
+      const bool is_default[] = {values._is_default...};
+      for (const auto value_is_default : is_default)
+      {
+        if (value_is_default)
+        {
+          throw sqlpp::exception{"default values are not supported by batch inserts"};
+        }
+      }
+      _rows.emplace_back();
+      _assign(_rows.back(), detail::make_index_sequence<sizeof...(Columns)>{}, values...);
+    }
+
+    template <size_t... Is, typename... InsertValues>
+    static void _assign(_row_t& row, const detail::index_sequence<Is...>& /*unused*/, const InsertValues&... values)
+    {
+      using swallow = int[];  // see interpret_tuple.h
+      (void)swallow{0, (_assign_value(std::get<Is>(row), values), 0)...};
+    }
+
+    template <typename ParameterValue, typename Column>
+    static void _assign_value(ParameterValue& parameter_value, const insert_value_t<Column>& value)
+    {
+      if (value._is_null)
+        parameter_value.set_null();
+      else
+        parameter_value = value._value._t;
+    }
+
+    auto _chunk(_prepared_statement_t& prepared_statement, size_t first, size_t count)
+        -> detail::batch_insert_chunk_t<_prepared_statement_t, _row_t>
+    {
+      return {prepared_statement, _rows.data() + first, count};
+    }
+
+    batch_insert_t<Statement, Columns...> _batch;
+    _prepared_statement_t _prepared_statement;
+    std::unique_ptr<_prepared_statement_t> _tail_statement;
+    size_t _tail_rows{0};
+    std::vector<_row_t> _rows;
+  };
+}  // namespace sqlpp
@@ -29,6 +29,7 @@
 
 #include <sqlpp11/compat/make_unique.h>
 
+#include <chrono>
 #include <memory>
 #include <utility>
 
@@ -128,21 +129,28 @@ namespace sqlpp
         conn_release();
         static_cast<ConnectionBase&>(*this) = std::move(static_cast<ConnectionBase&>(other));
         _pool_core = std::move(other._pool_core);
+        _created = other._created;
       }
       return *this;
     }
 
   private:
     _pool_core_ptr_t _pool_core;
+    // Time when the underlying connection was opened, used by the pool to enforce a maximum lifetime
+    std::chrono::steady_clock::time_point _created;
 
     // Constructors used by the connection pool
-    pooled_connection(_handle_ptr_t&& handle, _pool_core_ptr_t pool_core)
-        : common_connection<ConnectionBase>(std::move(handle)), _pool_core(pool_core)
+    pooled_connection(_handle_ptr_t&& handle, _pool_core_ptr_t pool_core, std::chrono::steady_clock::time_point created)
+        : common_connection<ConnectionBase>(std::move(handle)), _pool_core(pool_core), _created(created)
     {
     }
 
-    pooled_connection(const _config_ptr_t& config, _pool_core_ptr_t pool_core)
-        : common_connection<ConnectionBase>(compat::make_unique<_handle_t>(config)), _pool_core(pool_core)
+    pooled_connection(const _config_ptr_t& config,
+                      _pool_core_ptr_t pool_core,
+                      std::chrono::steady_clock::time_point created)
+        : common_connection<ConnectionBase>(compat::make_unique<_handle_t>(config)),
+          _pool_core(pool_core),
+          _created(created)
     {
     }
 
@@ -150,7 +158,7 @@ namespace sqlpp
     {
       if (_pool_core)
       {
-        _pool_core->put(ConnectionBase::_handle);
+        _pool_core->put(ConnectionBase::_handle, _created);
         _pool_core = nullptr;
       }
     }
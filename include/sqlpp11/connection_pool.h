@@ -29,10 +29,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sqlpp11/connection.h>
 #include <sqlpp11/detail/circular_buffer.h>
+#include <sqlpp11/exception.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace sqlpp
 {
@@ -43,6 +50,45 @@ namespace sqlpp
     ping
   };
 
+  // Thrown by connection_pool::get() if no connection became available within the given timeout
+  class connection_pool_timeout : public sqlpp::exception
+  {
+  public:
+    using sqlpp::exception::exception;
+  };
+
+  struct connection_pool_options
+  {
+    // Upper bound for the number of live connections (idle + borrowed), 0 means unlimited
+    std::size_t max_connections = 0;
+    // Number of independently locked caches for idle connections. Each thread returns connections to and fetches
+    // them from its "home" shard first, so that threads on many-core machines rarely contend for the same lock.
+    // With a single shard, idle connections are reused in strict FIFO order.
+    std::size_t shards = 1;
+    // Interval of the background maintenance thread, which takes care of the settings below. Zero means no thread.
+    std::chrono::milliseconds maintenance_interval{0};
+    // Check applied to idle connections by the maintenance thread. Failing connections are closed.
+    connection_check idle_check = connection_check::ping;
+    // Idle connections that have not been used for this long are closed (as long as min_idle is kept), 0 disables
+    std::chrono::milliseconds idle_timeout{0};
+    // Connections older than this are closed when they are returned to the pool or found idle, 0 disables
+    std::chrono::milliseconds max_lifetime{0};
+    // The maintenance thread opens new connections until at least this many connections are idle
+    std::size_t min_idle = 0;
+  };
+
+  struct connection_pool_statistics
+  {
+    std::size_t idle = 0;       // connections cached in the pool
+    std::size_t live = 0;       // connections owned by the pool (idle + borrowed)
+    std::size_t waiters = 0;    // callers currently blocked in get()
+    std::size_t created = 0;    // connections opened since the pool was created
+    std::size_t destroyed = 0;  // connections discarded since the pool was created
+    std::size_t waits = 0;      // calls to get() that had to wait for a connection
+    std::size_t timeouts = 0;   // calls to get() that timed out
+    std::chrono::nanoseconds wait_time{0};  // accumulated time spent waiting in get()
+  };
+
   template <typename ConnectionBase>
   class connection_pool
   {
@@ -50,13 +96,40 @@ namespace sqlpp
     using _config_ptr_t = typename ConnectionBase::_config_ptr_t;
     using _handle_ptr_t = typename ConnectionBase::_handle_ptr_t;
     using _pooled_connection_t = sqlpp::pooled_connection<ConnectionBase>;
+    using _clock_t = std::chrono::steady_clock;
 
     class pool_core : public std::enable_shared_from_this<pool_core>
     {
     public:
-      pool_core(const _config_ptr_t& connection_config, std::size_t capacity)
-          : _connection_config{connection_config}, _handles{capacity}
+      pool_core(const _config_ptr_t& connection_config, std::size_t capacity, const connection_pool_options& options)
+          : _connection_config{connection_config}, _options{options}
+      {
+        if (_options.shards == 0)
+        {
+          throw std::invalid_argument{"Connection pool: number of shards cannot be zero"};
+        }
+        const auto shard_capacity = (capacity + _options.shards - 1) / _options.shards;
+        for (std::size_t i = 0; i < _options.shards; ++i)
+        {
+          _shards.emplace_back(new shard{shard_capacity});
+        }
+        if (_options.maintenance_interval.count() > 0)
+        {
+          _maintenance_thread = std::thread{&pool_core::run_maintenance, this};
+        }
+      }
+
+      ~pool_core()
       {
+        if (_maintenance_thread.joinable())
+        {
+          {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _stopped = true;
+          }
+          _maintenance_cv.notify_one();
+          _maintenance_thread.join();
+        }
       }
 
       pool_core() = delete;
@@ -68,40 +141,428 @@ namespace sqlpp
 
       _pooled_connection_t get(connection_check check)
       {
+        return acquire(check, false, _clock_t::time_point{});
+      }
+
+      _pooled_connection_t get(connection_check check, _clock_t::time_point deadline)
+      {
+        return acquire(check, true, deadline);
+      }
+
+      void put(_handle_ptr_t& handle, _clock_t::time_point created)
+      {
+        if (not handle or expired(created, _clock_t::now()))
+        {
+          discard(handle);
+          return;
+        }
+        give_back(idle_connection{std::move(handle), created, _clock_t::now()});
+      }
+
+      // Returns number of connections available in the pool. Only used in tests.
+      std::size_t available()
+      {
+        auto count = std::size_t{0};
+        for (auto& s : _shards)
+        {
+          std::unique_lock<std::mutex> lock{s->mutex};
+          count += s->handles.size();
+        }
+        return count;
+      }
+
+      // Idle connections are checked by the maintenance thread, if there is one
+      connection_check default_check() const
+      {
+        return _options.maintenance_interval.count() > 0 ? connection_check::none : connection_check::passive;
+      }
+
+      connection_pool_statistics statistics()
+      {
+        const auto idle = available();
         std::unique_lock<std::mutex> lock{_mutex};
-        if (_handles.empty())
+        auto stats = _stats;
+        stats.idle = idle;
+        stats.live = _live;
+        stats.waiters = _waiters.size();
+        return stats;
+      }
+
+    private:
+      struct idle_connection
+      {
+        _handle_ptr_t handle;
+        _clock_t::time_point created;
+        _clock_t::time_point returned;
+      };
+
+      // A lock-protected cache of idle connections
+      struct shard
+      {
+        shard(std::size_t capacity) : handles{capacity}
+        {
+        }
+
+        std::mutex mutex;
+        sqlpp::detail::circular_buffer<idle_connection> handles;
+      };
+
+      // A caller blocked in get(). It is either handed a connection or the permission to open a new one.
+      struct waiter
+      {
+        std::condition_variable cv;
+        idle_connection connection;
+        bool ready = false;
+      };
+
+      _pooled_connection_t acquire(connection_check check, bool has_deadline, _clock_t::time_point deadline)
+      {
+        auto connection = pop_idle();
+        if (connection.handle)
         {
+          return reuse_or_replace(connection, check);
+        }
+
+        std::unique_lock<std::mutex> lock{_mutex};
+        if (_options.maintenance_interval.count() > 0)
+        {
+          // The maintenance thread might have returned a connection since we last looked
+          connection = pop_idle();
+          if (connection.handle)
+          {
+            lock.unlock();
+            return reuse_or_replace(connection, check);
+          }
+        }
+        // Below max_connections, open a new connection rather than wait for one that is being checked by the
+        // maintenance thread, the check might take as long as the connection timeout
+        if (_options.max_connections == 0 or _live < _options.max_connections)
+        {
+          ++_live;
           lock.unlock();
-          return _pooled_connection_t{_connection_config, this->shared_from_this()};
+          return create();
         }
-        auto handle = std::move(_handles.front());
-        _handles.pop_front();
+
+        // The pool is exhausted, queue up behind the other waiters (if any). Connections that are being checked by the
+        // maintenance thread are handed to waiting callers afterwards.
+        waiter w;
+        _waiters.push_back(&w);
+        _waiting.store(_waiters.size());
+        // A connection might have been returned since we last looked
+        connection = pop_idle();
+        if (connection.handle)
+        {
+          remove_waiter(&w);
+          lock.unlock();
+          return reuse_or_replace(connection, check);
+        }
+        ++_stats.waits;
+        const auto start = _clock_t::now();
+        const auto is_ready = [&w] { return w.ready; };
+        if (has_deadline)
+        {
+          if (not w.cv.wait_until(lock, deadline, is_ready))
+          {
+            remove_waiter(&w);
+            ++_stats.timeouts;
+            _stats.wait_time += _clock_t::now() - start;
+            throw connection_pool_timeout{"Connection pool: timed out waiting for a connection"};
+          }
+        }
+        else
+        {
+          w.cv.wait(lock, is_ready);
+        }
+        _stats.wait_time += _clock_t::now() - start;
         lock.unlock();
+        if (w.connection.handle)
+        {
+          return reuse_or_replace(w.connection, check);
+        }
+        return create();
+      }
+
+      _pooled_connection_t reuse_or_replace(idle_connection& connection, connection_check check)
+      {
+        if (check_connection(connection.handle, check))
+        {
+          return _pooled_connection_t{std::move(connection.handle), this->shared_from_this(), connection.created};
+        }
         // If the fetched connection is dead, drop it and create a new one on the fly
-        return
-          check_connection(handle, check) ?
-          _pooled_connection_t{std::move(handle), this->shared_from_this()} :
-          _pooled_connection_t{_connection_config, this->shared_from_this()};
+        connection.handle.reset();
+        {
+          std::unique_lock<std::mutex> lock{_mutex};
+          ++_stats.destroyed;
+        }
+        return create();
+      }
+
+      // Opens a new connection for a slot that has already been accounted for in _live
+      _pooled_connection_t create()
+      {
+        try
+        {
+          auto connection = _pooled_connection_t{_connection_config, this->shared_from_this(), _clock_t::now()};
+          std::unique_lock<std::mutex> lock{_mutex};
+          ++_stats.created;
+          return connection;
+        }
+        catch (...)
+        {
+          std::unique_lock<std::mutex> lock{_mutex};
+          release_slot(lock);
+          throw;
+        }
       }
 
-      void put(_handle_ptr_t& handle)
+      // Closes a connection and gives up its slot
+      void discard(_handle_ptr_t& handle)
       {
+        const auto was_open = static_cast<bool>(handle);
+        handle.reset();
         std::unique_lock<std::mutex> lock{_mutex};
-        if (_handles.full())
+        if (was_open)
         {
-          _handles.set_capacity(_handles.capacity() + 5);
+          ++_stats.destroyed;
         }
-        _handles.push_back(std::move(handle));
+        release_slot(lock);
       }
 
-      // Returns number of connections available in the pool. Only used in tests.
-      std::size_t available()
+      // Makes a connection available again, either to a waiting caller or in the cache
+      void give_back(idle_connection connection)
       {
+        give_back(std::move(connection), *_shards[home_shard()]);
+      }
+
+      // Same as above, but caches the connection in the given shard
+      void give_back(idle_connection connection, shard& s)
+      {
+        if (_waiting.load() == 0)
+        {
+          push_idle(connection, s);
+          if (_waiting.load() == 0)
+          {
+            return;
+          }
+          // A caller started waiting concurrently, make sure it does not miss the idle connection
+          std::unique_lock<std::mutex> lock{_mutex};
+          hand_over_idle(lock);
+          return;
+        }
         std::unique_lock<std::mutex> lock{_mutex};
-        return _handles.size();
+        // Hand the connection directly to the longest waiting caller, if any
+        if (not _waiters.empty())
+        {
+          notify_waiter(std::move(connection));
+          return;
+        }
+        push_idle(connection, s);
+      }
+
+      bool expired(_clock_t::time_point created, _clock_t::time_point now) const
+      {
+        return _options.max_lifetime.count() > 0 and now - created >= _options.max_lifetime;
+      }
+
+      // Threads are assigned to shards round-robin on first use. Hashing std::thread::id does not spread them evenly,
+      // e.g. libc++ uses the address of the thread descriptor, whose low bits are the same for all threads.
+      std::size_t home_shard() const
+      {
+        static std::atomic<std::size_t> next_thread_index{0};
+        thread_local const auto thread_index = next_thread_index++;
+        return thread_index % _shards.size();
+      }
+
+      void push_idle(idle_connection& connection, shard& s)
+      {
+        std::unique_lock<std::mutex> lock{s.mutex};
+        if (s.handles.full())
+        {
+          s.handles.set_capacity(s.handles.capacity() + 5);
+        }
+        s.handles.push_back(std::move(connection));
+      }
+
+      idle_connection pop_idle(shard& s)
+      {
+        std::unique_lock<std::mutex> lock{s.mutex};
+        if (s.handles.empty())
+        {
+          return {};
+        }
+        auto connection = std::move(s.handles.front());
+        s.handles.pop_front();
+        return connection;
+      }
+
+      // Takes an idle connection from the home shard or, failing that, from any other shard
+      idle_connection pop_idle()
+      {
+        const auto home = home_shard();
+        for (std::size_t i = 0; i < _shards.size(); ++i)
+        {
+          auto connection = pop_idle(*_shards[(home + i) % _shards.size()]);
+          if (connection.handle)
+          {
+            return connection;
+          }
+        }
+        return {};
+      }
+
+      void notify_waiter(idle_connection connection)
+      {
+        auto* w = _waiters.front();
+        _waiters.pop_front();
+        _waiting.store(_waiters.size());
+        w->connection = std::move(connection);
+        w->ready = true;
+        w->cv.notify_one();
+      }
+
+      void remove_waiter(waiter* w)
+      {
+        _waiters.remove(w);
+        _waiting.store(_waiters.size());
+      }
+
+      // Moves idle connections to waiting callers
+      void hand_over_idle(std::unique_lock<std::mutex>&)
+      {
+        while (not _waiters.empty())
+        {
+          auto connection = pop_idle();
+          if (not connection.handle)
+          {
+            return;
+          }
+          notify_waiter(std::move(connection));
+        }
+      }
+
+      // Gives up a connection slot, passing it on to the longest waiting caller, if any
+      void release_slot(std::unique_lock<std::mutex>&)
+      {
+        if (not _waiters.empty())
+        {
+          notify_waiter({});
+          return;
+        }
+        --_live;
+      }
+
+      // Ends the check of an idle connection. Callers that waited for it in vain may open new connections now.
+      void finish_check()
+      {
+        std::unique_lock<std::mutex> lock{_mutex};
+        --_checking;
+        while (_waiters.size() > _checking and
+               (_options.max_connections == 0 or _live < _options.max_connections))
+        {
+          ++_live;
+          notify_waiter({});
+        }
+      }
+
+      void run_maintenance()
+      {
+        std::unique_lock<std::mutex> lock{_mutex};
+        while (not _stopped)
+        {
+          lock.unlock();
+          maintain_idle();
+          prewarm();
+          lock.lock();
+          _maintenance_cv.wait_for(lock, _options.maintenance_interval, [this] { return _stopped; });
+        }
+      }
+
+      // Visits each idle connection once, closing the ones that are dead, expired or idle for too long.
+      // Connections are returned to the shard they were taken from.
+      void maintain_idle()
+      {
+        auto idle = available();
+        for (auto& s : _shards)
+        {
+          auto count = std::size_t{0};
+          {
+            std::unique_lock<std::mutex> lock{s->mutex};
+            count = s->handles.size();
+          }
+          for (std::size_t i = 0; i < count; ++i)
+          {
+            {
+              std::unique_lock<std::mutex> lock{_mutex};
+              ++_checking;
+            }
+            auto connection = pop_idle(*s);
+            if (not connection.handle)
+            {
+              finish_check();
+              break;
+            }
+            const auto now = _clock_t::now();
+            const auto idle_too_long = _options.idle_timeout.count() > 0 and idle > _options.min_idle and
+                                       now - connection.returned >= _options.idle_timeout;
+            if (idle_too_long or expired(connection.created, now) or not is_alive(connection.handle))
+            {
+              discard(connection.handle);
+              --idle;
+            }
+            else
+            {
+              give_back(std::move(connection), *s);
+            }
+            finish_check();
+          }
+        }
+      }
+
+      // Opens connections until min_idle connections are idle (without exceeding max_connections)
+      void prewarm()
+      {
+        while (available() < _options.min_idle)
+        {
+          {
+            std::unique_lock<std::mutex> lock{_mutex};
+            if (_stopped or (_options.max_connections > 0 and _live >= _options.max_connections))
+            {
+              return;
+            }
+            ++_live;
+          }
+          auto handle = _handle_ptr_t{};
+          try
+          {
+            handle = compat::make_unique<typename ConnectionBase::_handle_t>(_connection_config);
+          }
+          catch (...)
+          {
+            // Try again in the next maintenance run
+            discard(handle);
+            return;
+          }
+          {
+            std::unique_lock<std::mutex> lock{_mutex};
+            ++_stats.created;
+          }
+          const auto now = _clock_t::now();
+          give_back(idle_connection{std::move(handle), now, now});
+        }
+      }
+
+      bool is_alive(_handle_ptr_t& handle)
+      {
+        try
+        {
+          return check_connection(handle, _options.idle_check);
+        }
+        catch (...)
+        {
+          return false;
+        }
       }
 
-    private:
       inline bool check_connection(_handle_ptr_t& handle, connection_check check)
       {
         switch (check)
@@ -118,14 +579,27 @@ namespace sqlpp
       }
 
       _config_ptr_t _connection_config;
-      sqlpp::detail::circular_buffer<_handle_ptr_t> _handles;
+      connection_pool_options _options;
+      std::vector<std::unique_ptr<shard>> _shards;
+      // Guards everything below. Not needed for fetching or returning idle connections.
       std::mutex _mutex;
+      std::list<waiter*> _waiters;
+      std::atomic<std::size_t> _waiting{0};
+      std::size_t _live = 0;
+      // Number of idle connections the maintenance thread has taken out of the pool for checking
+      std::size_t _checking = 0;
+      connection_pool_statistics _stats;
+      bool _stopped = false;
+      std::condition_variable _maintenance_cv;
+      std::thread _maintenance_thread;
     };
 
     connection_pool() = default;
 
-    connection_pool(const _config_ptr_t& connection_config, std::size_t capacity)
-        : _core{std::make_shared<pool_core>(connection_config, capacity)}
+    connection_pool(const _config_ptr_t& connection_config,
+                    std::size_t capacity,
+                    const connection_pool_options& options = {})
+        : _core{std::make_shared<pool_core>(connection_config, capacity, options)}
     {
     }
 
@@ -135,26 +609,53 @@ namespace sqlpp
     connection_pool& operator=(const connection_pool&) = delete;
     connection_pool& operator=(connection_pool&&) = default;
 
-    void initialize(const _config_ptr_t& connection_config, std::size_t capacity)
+    void initialize(const _config_ptr_t& connection_config,
+                    std::size_t capacity,
+                    const connection_pool_options& options = {})
     {
       if (_core)
       {
         throw std::runtime_error{"Connection pool already initialized"};
       }
-      _core = std::make_shared<pool_core>(connection_config, capacity);
+      _core = std::make_shared<pool_core>(connection_config, capacity, options);
     }
 
-    _pooled_connection_t get(connection_check check = connection_check::passive)
+    // Blocks without a time limit if options.max_connections connections are in use.
+    // Connections are checked passively, or not at all if the maintenance thread checks the idle connections.
+    _pooled_connection_t get()
+    {
+      return get(_core->default_check());
+    }
+
+    _pooled_connection_t get(connection_check check)
     {
       return _core->get(check);
     }
 
+    // Throws connection_pool_timeout if no connection becomes available within the timeout
+    template <typename Rep, typename Period>
+    _pooled_connection_t get(const std::chrono::duration<Rep, Period>& timeout)
+    {
+      return get(timeout, _core->default_check());
+    }
+
+    template <typename Rep, typename Period>
+    _pooled_connection_t get(const std::chrono::duration<Rep, Period>& timeout, connection_check check)
+    {
+      return _core->get(check, _clock_t::now() + std::chrono::duration_cast<_clock_t::duration>(timeout));
+    }
+
     // Returns number of connections available in the pool. Only used in tests.
     std::size_t available()
     {
       return _core->available();
     }
 
+    connection_pool_statistics statistics()
+    {
+      return _core->statistics();
+    }
+
   private:
     std::shared_ptr<pool_core> _core;
   };
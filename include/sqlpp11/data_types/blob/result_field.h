@@ -27,12 +27,18 @@
  */
 
 #include <sqlpp11/basic_expression_operators.h>
+#include <sqlpp11/compat/sqlpp_cxx_std.h>
 #include <sqlpp11/result_field.h>
 #include <sqlpp11/result_field_base.h>
 #include <sqlpp11/data_types/blob/data_type.h>
 #include <sqlpp11/field_spec.h>
+#include <algorithm>
 #include <ostream>
+#include <utility>
 #include <string>
+#if SQLPP_CXX_STD >= 202002L
+#include <span>
+#endif
 
 namespace sqlpp
 {
@@ -40,29 +46,132 @@ namespace sqlpp
   struct result_field_t<Db, field_spec_t<NameType, blob, CanBeNull>>
       : public result_field_base<Db, field_spec_t<NameType, blob, CanBeNull>>
   {
+    using _base_t = result_field_base<Db, field_spec_t<NameType, ::sqlpp::blob, CanBeNull>>;
+    using typename _base_t::_cpp_value_type;
+
     const uint8_t* blob{nullptr};  // Non-owning
     size_t len{};
+    // The connector uses zero copy results: _value is not filled, value() copies blob on demand
+    bool _is_view{false};
+
+    result_field_t() = default;
+
+    // Copies own their value, the blob of a view is only valid until the next row is fetched
+    result_field_t(const result_field_t& rhs) : _base_t{}
+    {
+      *this = rhs;
+    }
+
+    result_field_t& operator=(const result_field_t& rhs)
+    {
+      _base_t::operator=(rhs);
+      if (rhs._is_view and not this->_is_null)
+      {
+        this->_value.assign(rhs.blob, rhs.blob + rhs.len);
+      }
+      _is_view = false;
+      _point_at_value();
+      return *this;
+    }
+
+    // Owning fields point blob at their own value, which may be stored inline and therefore move with the field
+    result_field_t(result_field_t&& rhs)
+        : _base_t{std::move(rhs)}, blob{rhs.blob}, len{rhs.len}, _is_view{rhs._is_view}
+    {
+      if (not _is_view)
+      {
+        _point_at_value();
+      }
+    }
+
+    result_field_t& operator=(result_field_t&& rhs)
+    {
+      _base_t::operator=(std::move(rhs));
+      blob = rhs.blob;
+      len = rhs.len;
+      _is_view = rhs._is_view;
+      if (not _is_view)
+      {
+        _point_at_value();
+      }
+      return *this;
+    }
 
     template <typename Target>
     void _bind(Target& target, size_t index)
     {
       target._bind_blob_result(index, &blob, &len);
-      if (blob)
-        this->_value.assign(blob, blob + len);
-      else
-        this->_value.clear();
-      this->_is_null = (blob == nullptr);
+      _assign(detail::zero_copy_results(target));
     }
 
     template <typename Target>
     void _post_bind(Target& target, size_t index)
     {
       target._post_bind_blob_result(index, &blob, &len);
+      _assign(detail::zero_copy_results(target));
+    }
+
+    _cpp_value_type value() const
+    {
+      this->_load();
+      if (_is_view and not this->is_null())
+      {
+        return {blob, blob + len};
+      }
+      return _base_t::value();
+    }
+
+    operator _cpp_value_type() const
+    {
+      return value();
+    }
+
+    bool operator==(const _cpp_value_type& rhs) const
+    {
+      this->_load();
+      if (_is_view and not this->is_null())
+      {
+        return len == rhs.size() and std::equal(blob, blob + len, rhs.begin());
+      }
+      return _base_t::operator==(rhs);
+    }
+
+    bool operator!=(const _cpp_value_type& rhs) const
+    {
+      return not operator==(rhs);
+    }
+
+#if SQLPP_CXX_STD >= 202002L
+    // Non-owning, valid until the next row is fetched
+    std::span<const uint8_t> view() const
+    {
+      if (this->is_null())
+      {
+        return {};
+      }
+      return {blob, len};
+    }
+#endif
+
+  private:
+    void _point_at_value()
+    {
+      blob = this->_is_null ? nullptr : this->_value.data();
+      len = this->_is_null ? 0 : this->_value.size();
+    }
+
+    void _assign(bool zero_copy)
+    {
+      _is_view = zero_copy;
+      this->_is_null = (blob == nullptr);
+      if (zero_copy)
+      {
+        return;
+      }
       if (blob)
         this->_value.assign(blob, blob + len);
       else
         this->_value.clear();
-      this->_is_null = (blob == nullptr);
     }
   };
 
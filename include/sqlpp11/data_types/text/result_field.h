@@ -27,11 +27,17 @@
  */
 
 #include <sqlpp11/basic_expression_operators.h>
+#include <sqlpp11/compat/sqlpp_cxx_std.h>
 #include <sqlpp11/result_field.h>
 #include <sqlpp11/result_field_base.h>
 #include <sqlpp11/data_types/text/data_type.h>
 #include <sqlpp11/field_spec.h>
+#include <cstring>
 #include <ostream>
+#include <utility>
+#if SQLPP_CXX_STD >= 201703L
+#include <string_view>
+#endif
 
 namespace sqlpp
 {
@@ -39,28 +45,128 @@ namespace sqlpp
   struct result_field_t<Db, field_spec_t<NameType, text, CanBeNull>>
       : public result_field_base<Db, field_spec_t<NameType, text, CanBeNull>>
   {
+    using _base_t = result_field_base<Db, field_spec_t<NameType, ::sqlpp::text, CanBeNull>>;
+    using typename _base_t::_cpp_value_type;
+
     const char* text{nullptr};  // Non-owning
     size_t len{};
+    // The connector uses zero copy results: _value is not filled, value() copies text on demand
+    bool _is_view{false};
 
-    template <typename Target>
-    void _bind(Target& target, size_t index)
+    result_field_t() = default;
+
+    // Copies own their value, the text of a view is only valid until the next row is fetched
+    result_field_t(const result_field_t& rhs) : _base_t{}
     {
-      target._bind_text_result(index, &text, &len);
-      if (text)
+      *this = rhs;
+    }
+
+    result_field_t& operator=(const result_field_t& rhs)
+    {
+      _base_t::operator=(rhs);
+      if (rhs._is_view and not this->_is_null)
       {
-        this->_value.assign(text, len);
+        this->_value.assign(rhs.text, rhs.len);
       }
-      else
+      _is_view = false;
+      _point_at_value();
+      return *this;
+    }
+
+    // Owning fields point text at their own value, which may be stored inline and therefore move with the field
+    result_field_t(result_field_t&& rhs)
+        : _base_t{std::move(rhs)}, text{rhs.text}, len{rhs.len}, _is_view{rhs._is_view}
+    {
+      if (not _is_view)
       {
-        this->_value.assign("");
+        _point_at_value();
       }
-      this->_is_null = (text == nullptr);
+    }
+
+    result_field_t& operator=(result_field_t&& rhs)
+    {
+      _base_t::operator=(std::move(rhs));
+      text = rhs.text;
+      len = rhs.len;
+      _is_view = rhs._is_view;
+      if (not _is_view)
+      {
+        _point_at_value();
+      }
+      return *this;
+    }
+
+    template <typename Target>
+    void _bind(Target& target, size_t index)
+    {
+      target._bind_text_result(index, &text, &len);
+      _assign(detail::zero_copy_results(target));
     }
 
     template <typename Target>
     void _post_bind(Target& target, size_t index)
     {
       target._post_bind_text_result(index, &text, &len);
+      _assign(detail::zero_copy_results(target));
+    }
+
+    _cpp_value_type value() const
+    {
+      this->_load();
+      if (_is_view and not this->is_null())
+      {
+        return {text, len};
+      }
+      return _base_t::value();
+    }
+
+    operator _cpp_value_type() const
+    {
+      return value();
+    }
+
+    bool operator==(const _cpp_value_type& rhs) const
+    {
+      this->_load();
+      if (_is_view and not this->is_null())
+      {
+        return len == rhs.size() and (len == 0 or std::memcmp(text, rhs.data(), len) == 0);
+      }
+      return _base_t::operator==(rhs);
+    }
+
+    bool operator!=(const _cpp_value_type& rhs) const
+    {
+      return not operator==(rhs);
+    }
+
+#if SQLPP_CXX_STD >= 201703L
+    // Non-owning, valid until the next row is fetched
+    std::string_view view() const
+    {
+      if (this->is_null())
+      {
+        return {};
+      }
+      return {text, len};
+    }
+#endif
+
+  private:
+    void _point_at_value()
+    {
+      text = this->_is_null ? nullptr : this->_value.data();
+      len = this->_is_null ? 0 : this->_value.size();
+    }
+
+    void _assign(bool zero_copy)
+    {
+      _is_view = zero_copy;
+      this->_is_null = (text == nullptr);
+      if (zero_copy)
+      {
+        return;
+      }
       if (text)
       {
         this->_value.assign(text, len);
@@ -69,7 +175,6 @@ namespace sqlpp
       {
         this->_value.assign("");
       }
-      this->_is_null = (text == nullptr);
     }
   };
 
@@ -0,0 +1,244 @@
+#pragma once
+
+/*
+ * Copyright (c) 2023, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cerrno>
+#include <clocale>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+
+#if __cplusplus >= 201703L
+#include <charconv>
+#endif
+
+namespace sqlpp
+{
+  namespace detail
+  {
+    // Locale independent and allocation free parsing of numbers as they are sent by database servers in text format.
+    // Like std::strtoll and friends, parsing stops at the first character that does not belong to the number.
+    // The functions return false if there is no number at all or if it is out of range.
+
+    // Reads an optional sign and decimal digits. Returns the end of the number or nullptr.
+    inline const char* parse_magnitude(uint64_t& magnitude, bool& negative, const char* begin, const char* end)
+    {
+      negative = false;
+      if (begin != end and (*begin == '-' or *begin == '+'))
+      {
+        negative = (*begin == '-');
+        ++begin;
+      }
+      if (begin == end or *begin < '0' or *begin > '9')
+      {
+        return nullptr;
+      }
+      magnitude = 0;
+      for (; begin != end and *begin >= '0' and *begin <= '9'; ++begin)
+      {
+        const auto digit = static_cast<uint64_t>(*begin - '0');
+        if (magnitude > (std::numeric_limits<uint64_t>::max() - digit) / 10)
+        {
+          return nullptr;
+        }
+        magnitude = magnitude * 10 + digit;
+      }
+      return begin;
+    }
+
+    inline bool parse_int64(int64_t& value, const char* begin, const char* end)
+    {
+      auto magnitude = uint64_t{};
+      auto negative = false;
+      if (parse_magnitude(magnitude, negative, begin, end) == nullptr or
+          magnitude > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + (negative ? 1u : 0u))
+      {
+        return false;
+      }
+      value = negative ? static_cast<int64_t>(0u - magnitude) : static_cast<int64_t>(magnitude);
+      return true;
+    }
+
+    // Negative values wrap around, like with std::strtoull
+    inline bool parse_uint64(uint64_t& value, const char* begin, const char* end)
+    {
+      auto magnitude = uint64_t{};
+      auto negative = false;
+      if (parse_magnitude(magnitude, negative, begin, end) == nullptr)
+      {
+        return false;
+      }
+      value = negative ? 0u - magnitude : magnitude;
+      return true;
+    }
+
+    inline bool parse_literal(const char*& begin, const char* end, const char* literal)
+    {
+      auto current = begin;
+      for (; *literal; ++literal, ++current)
+      {
+        if (current == end or std::tolower(*current, std::locale::classic()) != *literal)
+        {
+          return false;
+        }
+      }
+      begin = current;
+      return true;
+    }
+
+    // Without std::from_chars, values that can be computed exactly from their decimal digits (like the vast majority of
+    // values stored in databases) are parsed directly, see Clinger, "How to read floating point numbers accurately".
+    // Everything else is handed to std::strtod or, if the global locale does not use '.' as decimal point, to an
+    // std::istringstream with the classic locale.
+    // This is what parse_double() uses if std::from_chars is not available. It is available in all modes for testing.
+    inline bool parse_double_without_from_chars(double& value, const char* begin, const char* end)
+    {
+      auto current = begin;
+      auto negative = false;
+      if (current != end and (*current == '-' or *current == '+'))
+      {
+        negative = (*current == '-');
+        ++current;
+      }
+      if (parse_literal(current, end, "infinity") or parse_literal(current, end, "inf"))
+      {
+        value = negative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+        return true;
+      }
+      if (parse_literal(current, end, "nan"))
+      {
+        value = std::numeric_limits<double>::quiet_NaN();
+        return true;
+      }
+
+      auto mantissa = uint64_t{};
+      auto significant_digits = 0;
+      auto exponent = 0;
+      auto has_digits = false;
+      auto exact = true;
+      auto add_digit = [&](char ch) {
+        has_digits = true;
+        if (mantissa == 0 and ch == '0')
+        {
+          return false;
+        }
+        if (++significant_digits > 19)
+        {
+          exact = false;
+          return true;
+        }
+        mantissa = mantissa * 10 + static_cast<uint64_t>(ch - '0');
+        return false;
+      };
+      for (; current != end and *current >= '0' and *current <= '9'; ++current)
+      {
+        exponent += add_digit(*current) ? 1 : 0;
+      }
+      if (current != end and *current == '.')
+      {
+        for (++current; current != end and *current >= '0' and *current <= '9'; ++current)
+        {
+          exponent -= add_digit(*current) ? 0 : 1;
+        }
+      }
+      if (not has_digits)
+      {
+        return false;
+      }
+      if (current != end and (*current == 'e' or *current == 'E'))
+      {
+        auto exponent_magnitude = uint64_t{};
+        auto negative_exponent = false;
+        if (const auto exponent_end = parse_magnitude(exponent_magnitude, negative_exponent, current + 1, end))
+        {
+          if (exponent_magnitude > 100000)
+          {
+            exact = false;
+          }
+          else
+          {
+            exponent += negative_exponent ? -static_cast<int>(exponent_magnitude) : static_cast<int>(exponent_magnitude);
+          }
+          current = exponent_end;
+        }
+      }
+
+      static constexpr double powers_of_ten[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                                 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+      if (mantissa == 0)
+      {
+        // Zeros can have any number of digits (e.g. numeric(40,30)) and any exponent
+        value = negative ? -0.0 : 0.0;
+        return true;
+      }
+      if (exact and mantissa <= (uint64_t{1} << 53) and exponent >= -22 and exponent <= 22)
+      {
+        const auto magnitude = static_cast<double>(mantissa);
+        value = exponent < 0 ? magnitude / powers_of_ten[-exponent] : magnitude * powers_of_ten[exponent];
+        value = negative ? -value : value;
+        return true;
+      }
+
+      // std::strtod is correctly rounded, but depends on the decimal point of the global C locale
+      char buffer[64];
+      const auto length = static_cast<size_t>(current - begin);
+      if (length < sizeof(buffer) and std::localeconv()->decimal_point[0] == '.')
+      {
+        std::memcpy(buffer, begin, length);
+        buffer[length] = '\0';
+        errno = 0;
+        value = std::strtod(buffer, nullptr);
+        return errno != ERANGE;
+      }
+      std::istringstream is{std::string{begin, current}};
+      is.imbue(std::locale::classic());
+      is >> value;
+      return not is.fail();
+    }
+
+#if defined(__cpp_lib_to_chars)
+    inline bool parse_double(double& value, const char* begin, const char* end)
+    {
+      if (begin != end and *begin == '+')
+      {
+        ++begin;  // not accepted by std::from_chars
+      }
+      return std::from_chars(begin, end, value).ec == std::errc{};
+    }
+#else
+    inline bool parse_double(double& value, const char* begin, const char* end)
+    {
+      return parse_double_without_from_chars(value, begin, end);
+    }
+#endif
+  }  // namespace detail
+}  // namespace sqlpp
@@ -0,0 +1,199 @@
+#pragma once
+
+/*
+ * Copyright (c) 2023, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clocale>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <sqlpp11/detail/enable_if.h>
+#include <sqlpp11/detail/float_safe_ostringstream.h>
+
+namespace sqlpp
+{
+  namespace detail
+  {
+    // Appends x to out, producing the same text as float_safe_ostringstream (for everything but exotic
+    // stream state), but without going through a stream for strings and numbers
+    template <typename T, typename = void>
+    struct serialization_buffer_implementation
+    {
+      template <typename U>
+      void operator()(std::string& out, U&& x) const
+      {
+        float_safe_ostringstream os;
+        os << std::forward<U>(x);
+        out += os.str();
+      }
+    };
+
+    template <typename T>
+    struct serialization_buffer_implementation<
+        T,
+        enable_if_t<std::is_integral<T>::value and not std::is_same<T, bool>::value and
+                    not std::is_same<T, char>::value and not std::is_same<T, signed char>::value and
+                    not std::is_same<T, unsigned char>::value>>
+    {
+      void operator()(std::string& out, T x) const
+      {
+        using unsigned_t = typename std::make_unsigned<T>::type;
+        char digits[std::numeric_limits<unsigned_t>::digits10 + 2];
+        char* const end = digits + sizeof(digits);
+        char* begin = end;
+        // Negate in unsigned arithmetic, so that the minimum value does not overflow
+        auto magnitude = x < 0 ? static_cast<unsigned_t>(0u - static_cast<unsigned_t>(x)) : static_cast<unsigned_t>(x);
+        do
+        {
+          *--begin = static_cast<char>('0' + magnitude % 10);
+          magnitude /= 10;
+        } while (magnitude);
+        if (x < 0)
+        {
+          out.push_back('-');
+        }
+        out.append(begin, end);
+      }
+    };
+
+    template <typename T>
+    struct serialization_buffer_implementation<T, enable_if_t<std::is_floating_point<T>::value>>
+    {
+      void operator()(std::string& out, T x) const
+      {
+        // Same as a stream in the classic locale with precision max_digits10
+        char text[64];
+        const auto length = std::is_same<T, long double>::value
+                                ? std::snprintf(text, sizeof(text), "%.*Lg", std::numeric_limits<T>::max_digits10,
+                                                static_cast<long double>(x))
+                                : std::snprintf(text, sizeof(text), "%.*g", std::numeric_limits<T>::max_digits10,
+                                                static_cast<double>(x));
+        const auto begin = out.size();
+        out.append(text, static_cast<size_t>(length));
+        const char decimal_point = *std::localeconv()->decimal_point;
+        if (decimal_point != '.')
+        {
+          for (auto i = begin; i < out.size(); ++i)
+          {
+            if (out[i] == decimal_point)
+            {
+              out[i] = '.';
+            }
+          }
+        }
+      }
+    };
+
+    template <typename T>
+    struct serialization_buffer_implementation<T, enable_if_t<std::is_same<T, bool>::value>>
+    {
+      void operator()(std::string& out, bool x) const
+      {
+        out.push_back(x ? '1' : '0');
+      }
+    };
+
+    template <typename T>
+    struct serialization_buffer_implementation<
+        T,
+        enable_if_t<std::is_same<T, char>::value or std::is_same<T, signed char>::value or
+                    std::is_same<T, unsigned char>::value>>
+    {
+      void operator()(std::string& out, T x) const
+      {
+        out.push_back(static_cast<char>(x));
+      }
+    };
+
+    template <>
+    struct serialization_buffer_implementation<const char*>
+    {
+      void operator()(std::string& out, const char* x) const
+      {
+        out.append(x);
+      }
+    };
+
+    template <>
+    struct serialization_buffer_implementation<char*> : serialization_buffer_implementation<const char*>
+    {
+    };
+
+    template <>
+    struct serialization_buffer_implementation<std::string>
+    {
+      void operator()(std::string& out, const std::string& x) const
+      {
+        out.append(x);
+      }
+    };
+
+    // Text of a statement being serialized by a connector's context. The memory is borrowed from the connection and
+    // handed back afterwards, so that serializing a statement usually does not allocate at all.
+    class serialization_buffer
+    {
+    public:
+      // Larger buffers are released instead of being kept by the connection
+      static constexpr size_t max_reused_capacity = 64 * 1024;
+
+      serialization_buffer(std::string& owner) : _owner(owner)
+      {
+        _text.swap(_owner);
+        _text.clear();
+      }
+      serialization_buffer(const serialization_buffer&) = delete;
+      serialization_buffer(serialization_buffer&&) = delete;
+      serialization_buffer& operator=(const serialization_buffer&) = delete;
+      serialization_buffer& operator=(serialization_buffer&&) = delete;
+      ~serialization_buffer()
+      {
+        if (_text.capacity() <= max_reused_capacity)
+        {
+          _owner.swap(_text);
+        }
+      }
+
+      template <typename T>
+      serialization_buffer& operator<<(T&& x)
+      {
+        serialization_buffer_implementation<typename std::decay<T>::type>{}(_text, std::forward<T>(x));
+        return *this;
+      }
+
+      const std::string& str() const
+      {
+        return _text;
+      }
+
+    private:
+      std::string& _owner;
+      std::string _text;
+    };
+  }  // namespace detail
+}  // namespace sqlpp
@@ -0,0 +1,157 @@
+#pragma once
+
+/*
+ * Copyright (c) 2023, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace sqlpp
+{
+  // Counters of a connection's prepared statement cache, see connection_config::statement_cache_size
+  struct statement_cache_stats
+  {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t size = 0;
+    size_t capacity = 0;
+  };
+
+  namespace detail
+  {
+    // LRU cache of native prepared statement handles, keyed by the serialized statement. It lives in a connector's
+    // connection handle, so it survives the handle's trip through the connection pool.
+    //
+    // A cached handle is lent to one prepared statement (and its results) at a time: The returned shared_ptr calls
+    // Handle::recycle() once the last copy is gone, and the statement becomes available again. Evicted handles are
+    // destroyed (i.e. deallocated on the server) as soon as they are not lent anymore.
+    template <typename Handle>
+    class statement_cache
+    {
+    public:
+      explicit statement_cache(size_t capacity = 0) : _capacity(capacity)
+      {
+      }
+
+      statement_cache(const statement_cache&) = delete;
+      statement_cache(statement_cache&&) = default;
+      statement_cache& operator=(const statement_cache&) = delete;
+      statement_cache& operator=(statement_cache&&) = default;
+      ~statement_cache() = default;
+
+      bool enabled() const
+      {
+        return _capacity > 0;
+      }
+
+      // Returns the cached handle for the statement, or nullptr if there is none or if it is currently lent
+      std::shared_ptr<Handle> get(const std::string& statement)
+      {
+        if (not enabled())
+        {
+          return nullptr;
+        }
+        const auto it = _entries.find(statement);
+        if (it == _entries.end() or not it->second.lease.expired())
+        {
+          ++_misses;
+          return nullptr;
+        }
+        ++_hits;
+        _usage.splice(_usage.begin(), _usage, it->second.usage);
+        return lend(it->second);
+      }
+
+      // Stores a freshly prepared handle (evicting the least recently used one if the cache is full) and lends it
+      std::shared_ptr<Handle> put(const std::string& statement, std::shared_ptr<Handle> handle)
+      {
+        if (not enabled())
+        {
+          return handle;
+        }
+        auto it = _entries.find(statement);
+        if (it != _entries.end())
+        {
+          // The cached handle is lent, the new one replaces it in the cache
+          _usage.erase(it->second.usage);
+          _entries.erase(it);
+        }
+        while (_entries.size() >= _capacity)
+        {
+          _entries.erase(_entries.find(*_usage.back()));
+          _usage.pop_back();
+        }
+        it = _entries.emplace(statement, entry_t{std::move(handle), {}, {}}).first;
+        _usage.push_front(&it->first);
+        it->second.usage = _usage.begin();
+        return lend(it->second);
+      }
+
+      void clear()
+      {
+        _usage.clear();
+        _entries.clear();
+      }
+
+      statement_cache_stats stats() const
+      {
+        statement_cache_stats result;
+        result.hits = _hits;
+        result.misses = _misses;
+        result.size = _entries.size();
+        result.capacity = _capacity;
+        return result;
+      }
+
+    private:
+      struct entry_t
+      {
+        std::shared_ptr<Handle> handle;
+        std::weak_ptr<Handle> lease;
+        std::list<const std::string*>::iterator usage;
+      };
+
+      std::shared_ptr<Handle> lend(entry_t& entry)
+      {
+        // The deleter keeps the handle alive, even if it is evicted while being lent
+        auto handle = entry.handle;
+        auto lease = std::shared_ptr<Handle>(handle.get(), [handle](Handle* h) { h->recycle(); });
+        entry.lease = lease;
+        return lease;
+      }
+
+      size_t _capacity;
+      size_t _hits = 0;
+      size_t _misses = 0;
+      std::unordered_map<std::string, entry_t> _entries;
+      std::list<const std::string*> _usage;  // most recently used first, points to the keys of _entries
+    };
+  }  // namespace detail
+}  // namespace sqlpp
@@ -29,6 +29,7 @@
 #include <sqlpp11/noop.h>
 #include <sqlpp11/parameter.h>
 #include <sqlpp11/parameter_list.h>
+#include <sqlpp11/list_parameter.h>
 #include <sqlpp11/data_types.h>
 #include <sqlpp11/aggregate_functions.h>
 #include <sqlpp11/trim.h>
@@ -86,7 +87,7 @@ namespace sqlpp
 
     using _container_t = Container;
 
-    value_list_t(_container_t container) : _container(container)
+    value_list_t(_container_t container) : _container(std::move(container))
     {
     }
 
@@ -130,18 +131,18 @@ namespace sqlpp
     static_assert(
         is_wrapped_value_t<wrap_operand_t<typename Container::value_type>>::value,
         "value_list() is to be called with a container of non-sql-type like std::vector<int>, or std::list(string)");
-    return {c};
+    return {std::move(c)};
   }
 
-  template <typename T>
-  constexpr const char* get_sql_name()
-  {
-    return name_of<T>::template char_ptr<void>();
-  }
-
-  template <typename T>
-  constexpr const char* get_sql_name(const T& /*unused*/)
-  {
-    return get_sql_name<T>();
+  template <typename T>
+  constexpr const char* get_sql_name()
+  {
+    return name_of<T>::template char_ptr<void>();
+  }
+
+  template <typename T>
+  constexpr const char* get_sql_name(const T& /*unused*/)
+  {
+    return get_sql_name<T>();
   }
 }  // namespace sqlpp
@@ -35,6 +35,7 @@
 #include <sqlpp11/noop.h>
 #include <sqlpp11/into.h>
 #include <sqlpp11/insert_value_list.h>
+#include <sqlpp11/batch_insert.h>
 
 namespace sqlpp
 {
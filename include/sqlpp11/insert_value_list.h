@@ -28,6 +28,7 @@
 
 #include <sqlpp11/assignment.h>
 #include <sqlpp11/column_fwd.h>
+#include <sqlpp11/exception.h>
 #include <sqlpp11/expression_fwd.h>
 #include <sqlpp11/insert_value.h>
 #include <sqlpp11/interpret_tuple.h>
@@ -42,6 +43,9 @@
 
 namespace sqlpp
 {
+  template <typename Statement, typename... Columns>
+  struct batch_insert_t;
+
   namespace detail
   {
     template <typename... Columns>
@@ -442,6 +446,16 @@ namespace sqlpp
         return t.values;
       }
 
+      //! multi-row insert with one parameter per column and row, has to be prepared, see batch_insert.h
+      auto batch(size_t rows) const -> batch_insert_t<typename Policies::_statement_t, Columns...>
+      {
+        if (not values._data._insert_values.empty())
+        {
+          throw sqlpp::exception{"batch() cannot be combined with values added via add()"};
+        }
+        return {static_cast<const typename Policies::_statement_t&>(*this), rows};
+      }
+
       using _consistency_check = typename std::conditional<Policies::template _no_unknown_tables<column_list_t>::value,
                                                            consistent_t,
                                                            assert_no_unknown_tables_in_column_list_t>::type;
@@ -0,0 +1,145 @@
+#pragma once
+
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp11/type_traits.h>
+#include <sqlpp11/alias_provider.h>
+#include <sqlpp11/in.h>
+#include <sqlpp11/not_in.h>
+#include <sqlpp11/parameter.h>
+#include <sqlpp11/wrong.h>
+
+#include <utility>
+#include <vector>
+
+namespace sqlpp
+{
+  // The value of a list_parameter_t, all elements are bound as a single parameter
+  template <typename ValueType>
+  struct list_parameter_value_t
+  {
+    using _value_type = ValueType;
+    using _cpp_value_type = typename ValueType::_cpp_value_type;
+    using _container_t = std::vector<_cpp_value_type>;
+
+    list_parameter_value_t() = default;
+
+    list_parameter_value_t& operator=(_container_t values)
+    {
+      _values = std::move(values);
+      return *this;
+    }
+
+    template <typename Container>
+    list_parameter_value_t& operator=(const Container& values)
+    {
+      _values.assign(std::begin(values), std::end(values));
+      return *this;
+    }
+
+    const _container_t& value() const
+    {
+      return _values;
+    }
+
+    template <typename Target>
+    void _bind(Target& target, size_t index) const
+    {
+      target._bind_list_parameter(index, &_values);
+    }
+
+  private:
+    _container_t _values;
+  };
+
+  // A parameter for a list of values, to be used in .in() and .not_in() only.
+  // The statement text does not depend on the number of values, so one prepared statement serves lists of any size.
+  template <typename ValueType, typename NameType>
+  struct list_parameter_t : public expression_operators<list_parameter_t<ValueType, NameType>, ValueType>
+  {
+    using _traits = make_traits<ValueType, tag::is_parameter, tag::is_expression>;
+
+    using _nodes = detail::type_vector<>;
+    using _parameters = detail::type_vector<list_parameter_t>;
+    using _can_be_null = std::false_type;
+    using _is_literal_expression = std::true_type;
+
+    using _instance_t = member_t<NameType, list_parameter_value_t<ValueType>>;
+
+    list_parameter_t() = default;
+
+    list_parameter_t(const list_parameter_t&) = default;
+    list_parameter_t(list_parameter_t&&) = default;
+    list_parameter_t& operator=(const list_parameter_t&) = default;
+    list_parameter_t& operator=(list_parameter_t&&) = default;
+    ~list_parameter_t() = default;
+  };
+
+  template <typename Context, typename ValueType, typename NameType>
+  Context& serialize(const list_parameter_t<ValueType, NameType>&, Context& context)
+  {
+    static_assert(wrong_t<ValueType, NameType>::value, "list_parameter() can only be used in in() and not_in()");
+    return context;
+  }
+
+  // Without special support by the connector, the list is bound as an array
+  template <typename Context, typename Operand, typename ValueType, typename NameType>
+  Context& serialize(const in_t<Operand, list_parameter_t<ValueType, NameType>>& t, Context& context)
+  {
+    serialize_operand(t._operand, context);
+    context << " = ANY(";
+    serialize(parameter_t<ValueType, NameType>{}, context);
+    context << ')';
+    return context;
+  }
+
+  template <typename Context, typename Operand, typename ValueType, typename NameType>
+  Context& serialize(const not_in_t<Operand, list_parameter_t<ValueType, NameType>>& t, Context& context)
+  {
+    serialize_operand(t._operand, context);
+    context << " <> ALL(";
+    serialize(parameter_t<ValueType, NameType>{}, context);
+    context << ')';
+    return context;
+  }
+
+  template <typename NamedExpr>
+  auto list_parameter(const NamedExpr& /*unused*/) -> list_parameter_t<value_type_of<NamedExpr>, NamedExpr>
+  {
+    static_assert(is_selectable_t<NamedExpr>::value, "not a named expression");
+    return {};
+  }
+
+  template <typename ValueType, typename AliasProvider>
+  auto list_parameter(const ValueType& /*unused*/, const AliasProvider& /*unused*/)
+      -> list_parameter_t<wrap_operand_t<ValueType>, AliasProvider>
+  {
+    static_assert(is_value_type_t<ValueType>::value, "first argument is not a value type");
+    static_assert(is_alias_provider_t<AliasProvider>::value, "second argument is not an alias provider");
+    return {};
+  }
+}  // namespace sqlpp
@@ -30,6 +30,7 @@
 #include <ciso646>  // Required to support boolean operator aliases
 #endif
 
+#include <algorithm>
 #include <limits>
 #include <iostream>
 #include <memory>
@@ -71,6 +72,11 @@ namespace sqlpp
         return _handle == rhs._handle;
       }
 
+      bool _zero_copy_results() const
+      {
+        return _handle and _handle->zero_copy_results;
+      }
+
       template <typename ResultRow>
       void next(ResultRow& result_row)
       {
@@ -82,6 +88,7 @@ namespace sqlpp
 
         if (&result_row != _result_row_address)
         {
+          size_result_buffers();
           result_row._bind(*this);  // sets row data to mysql bind data
           bind_impl();              // binds mysql statement to data
           _result_row_address = &result_row;
@@ -201,8 +208,8 @@ namespace sqlpp
         meta_data.len = len;
         meta_data.is_null = nullptr;
         meta_data.text_buffer = value;
-        if (meta_data.bound_text_buffer.empty())
-          meta_data.bound_text_buffer.resize(8);
+        if (meta_data.bound_text_buffer.size() < std::max(meta_data.text_buffer_size_hint, 8ul))
+          meta_data.bound_text_buffer.resize(std::max(meta_data.text_buffer_size_hint, 8ul));
 
         MYSQL_BIND& param{_handle->result_params[index]};
         param.buffer_type = MYSQL_TYPE_STRING;
@@ -224,8 +231,8 @@ namespace sqlpp
         meta_data.len = len;
         meta_data.is_null = nullptr;
         meta_data.text_buffer = reinterpret_cast<const char **>(value);
-        if (meta_data.bound_text_buffer.empty())
-          meta_data.bound_text_buffer.resize(8);
+        if (meta_data.bound_text_buffer.size() < std::max(meta_data.text_buffer_size_hint, 8ul))
+          meta_data.bound_text_buffer.resize(std::max(meta_data.text_buffer_size_hint, 8ul));
 
         MYSQL_BIND& param{_handle->result_params[index]};
         param.buffer_type = MYSQL_TYPE_BLOB;
@@ -376,6 +383,31 @@ namespace sqlpp
       }
 
     private:
+      // Sizes text and blob buffers from the result metadata, so that mysql_stmt_fetch rarely truncates.
+      // With stored results, the metadata knows the longest value of each column. Otherwise the declared column
+      // length is used, up to max_initial_result_buffer_size, and larger values still grow the buffer in next_impl.
+      void size_result_buffers()
+      {
+        if (_handle->result_buffers_sized and not _handle->store_results)
+          return;
+
+        MYSQL_RES* meta_data = mysql_stmt_result_metadata(_handle->mysql_stmt);
+        if (not meta_data)
+          return;
+
+        const MYSQL_FIELD* fields = mysql_fetch_fields(meta_data);
+        const auto no_of_fields =
+            std::min(static_cast<size_t>(mysql_num_fields(meta_data)), _handle->result_param_meta_data.size());
+        for (size_t index = 0; index < no_of_fields; ++index)
+        {
+          _handle->result_param_meta_data[index].text_buffer_size_hint =
+              _handle->store_results ? fields[index].max_length
+                                     : std::min(fields[index].length, detail::max_initial_result_buffer_size);
+        }
+        mysql_free_result(meta_data);
+        _handle->result_buffers_sized = true;
+      }
+
       void bind_impl()
       {
         if (_handle->debug)
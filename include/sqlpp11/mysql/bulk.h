@@ -0,0 +1,220 @@
+#pragma once
+
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sqlpp11/chrono.h>
+#include <sqlpp11/exception.h>
+#include <sqlpp11/mysql/detail/prepared_statement_handle.h>
+#include <sqlpp11/mysql/prepared_statement.h>
+#include <sqlpp11/mysql/sqlpp_mysql.h>
+
+// MariaDB Connector/C can send many parameter sets for a prepared statement in one go (STMT_ATTR_ARRAY_SIZE)
+#if defined(MARIADB_PACKAGE_VERSION_ID) && defined(STMT_INDICATOR_NULL)
+#define SQLPP_MYSQL_ARRAY_BINDING 1
+#else
+#define SQLPP_MYSQL_ARRAY_BINDING 0
+#endif
+
+namespace sqlpp
+{
+  namespace mysql
+  {
+    struct bulk_result_t
+    {
+      uint64_t affected_rows{0};
+      // Affected rows for each parameter set, only available if the statement was executed once per parameter set
+      std::vector<uint64_t> affected_rows_per_row;
+    };
+
+#if SQLPP_MYSQL_ARRAY_BINDING
+    namespace detail
+    {
+      // Column-wise parameter arrays for STMT_ATTR_ARRAY_SIZE, filled by binding one parameter list per row
+      struct bulk_column_t
+      {
+        enum_field_types buffer_type{MYSQL_TYPE_NULL};
+        bool is_unsigned{false};
+        size_t value_size{0};
+        std::vector<char> values;  // value_size bytes per row, unused for text
+        std::vector<char*> text_values;
+        std::vector<unsigned long> lengths;
+        std::vector<char> indicators;
+      };
+
+      class bulk_binder_t
+      {
+        std::vector<bulk_column_t>& _columns;
+        size_t _row;
+
+        bulk_column_t& column(size_t index, enum_field_types buffer_type, bool is_unsigned, size_t value_size, bool is_null)
+        {
+          auto& column = _columns[index];
+          column.buffer_type = buffer_type;
+          column.is_unsigned = is_unsigned;
+          column.value_size = value_size;
+          column.indicators[_row] = is_null ? STMT_INDICATOR_NULL : STMT_INDICATOR_NONE;
+          return column;
+        }
+
+        template <typename T>
+        void store(size_t index, enum_field_types buffer_type, bool is_unsigned, const T& value, bool is_null)
+        {
+          auto& c = column(index, buffer_type, is_unsigned, sizeof(T), is_null);
+          c.values.resize(c.indicators.size() * sizeof(T));
+          std::memcpy(c.values.data() + _row * sizeof(T), &value, sizeof(T));
+        }
+
+        template <typename T>
+        void store_time(size_t index, enum_field_types buffer_type, const T& value, bool is_null)
+        {
+          MYSQL_TIME bound_time{};
+          if (not is_null)
+          {
+            to_mysql_time(bound_time, value);
+          }
+          store(index, buffer_type, false, bound_time, is_null);
+        }
+
+      public:
+        bulk_binder_t(std::vector<bulk_column_t>& columns, size_t row) : _columns(columns), _row(row)
+        {
+        }
+
+        void _bind_boolean_parameter(size_t index, const signed char* value, bool is_null)
+        {
+          store(index, MYSQL_TYPE_TINY, false, *value, is_null);
+        }
+
+        void _bind_integral_parameter(size_t index, const int64_t* value, bool is_null)
+        {
+          store(index, MYSQL_TYPE_LONGLONG, false, *value, is_null);
+        }
+
+        void _bind_unsigned_integral_parameter(size_t index, const uint64_t* value, bool is_null)
+        {
+          store(index, MYSQL_TYPE_LONGLONG, true, *value, is_null);
+        }
+
+        void _bind_floating_point_parameter(size_t index, const double* value, bool is_null)
+        {
+          store(index, MYSQL_TYPE_DOUBLE, false, *value, is_null);
+        }
+
+        void _bind_text_parameter(size_t index, const std::string* value, bool is_null)
+        {
+          auto& c = column(index, MYSQL_TYPE_STRING, false, 0, is_null);
+          c.text_values.resize(c.indicators.size());
+          c.lengths.resize(c.indicators.size());
+          c.text_values[_row] = const_cast<char*>(value->data());
+          c.lengths[_row] = static_cast<unsigned long>(value->size());
+        }
+
+        void _bind_date_parameter(size_t index, const ::sqlpp::chrono::day_point* value, bool is_null)
+        {
+          store_time(index, MYSQL_TYPE_DATE, *value, is_null);
+        }
+
+        void _bind_date_time_parameter(size_t index, const ::sqlpp::chrono::microsecond_point* value, bool is_null)
+        {
+          store_time(index, MYSQL_TYPE_DATETIME, *value, is_null);
+        }
+
+        void _bind_time_of_day_parameter(size_t index, const ::std::chrono::microseconds* value, bool is_null)
+        {
+          store_time(index, MYSQL_TYPE_TIME, *value, is_null);
+        }
+      };
+
+      // Executes the statement once for each parameter list in a single round trip
+      template <typename ParameterList>
+      uint64_t execute_bulk(prepared_statement_handle_t& prepared_statement, const std::vector<ParameterList>& rows)
+      {
+        if (prepared_statement.debug)
+          std::cerr << "MySQL debug: Executing prepared statement for " << rows.size() << " parameter sets" << std::endl;
+
+        std::vector<bulk_column_t> columns(prepared_statement.stmt_params.size());
+        for (auto& column : columns)
+        {
+          column.indicators.resize(rows.size(), STMT_INDICATOR_NONE);
+        }
+        for (size_t row = 0; row < rows.size(); ++row)
+        {
+          bulk_binder_t binder{columns, row};
+          rows[row]._bind(binder);
+        }
+
+        std::vector<MYSQL_BIND> params(columns.size(), MYSQL_BIND{});
+        for (size_t index = 0; index < columns.size(); ++index)
+        {
+          auto& column = columns[index];
+          MYSQL_BIND& param{params[index]};
+          param.buffer_type = column.buffer_type;
+          param.is_unsigned = column.is_unsigned;
+          param.u.indicator = column.indicators.data();
+          if (column.buffer_type == MYSQL_TYPE_STRING)
+          {
+            param.buffer = column.text_values.data();
+            param.length = column.lengths.data();
+          }
+          else
+          {
+            param.buffer = column.values.data();
+            param.buffer_length = static_cast<unsigned long>(column.value_size);
+          }
+        }
+
+        auto array_size = static_cast<unsigned int>(rows.size());
+        if (mysql_stmt_attr_set(prepared_statement.mysql_stmt, STMT_ATTR_ARRAY_SIZE, &array_size))
+        {
+          throw sqlpp::exception{std::string{"MySQL error: Could not set array size of prepared statement: "} +
+                                 mysql_stmt_error(prepared_statement.mysql_stmt)};
+        }
+
+        const bool failed = mysql_stmt_bind_param(prepared_statement.mysql_stmt, params.data()) or
+                            mysql_stmt_execute(prepared_statement.mysql_stmt);
+        const auto error = failed ? std::string{mysql_stmt_error(prepared_statement.mysql_stmt)} : std::string{};
+
+        // Back to single executions for the regular prepared statement interface
+        array_size = 0;
+        mysql_stmt_attr_set(prepared_statement.mysql_stmt, STMT_ATTR_ARRAY_SIZE, &array_size);
+
+        if (failed)
+        {
+          throw sqlpp::exception{"MySQL error: Could not execute prepared statement with array binding: " + error};
+        }
+        return mysql_stmt_affected_rows(prepared_statement.mysql_stmt);
+      }
+    }  // namespace detail
+#endif
+  }  // namespace mysql
+}  // namespace sqlpp
@@ -44,6 +44,12 @@ namespace sqlpp
 {
   namespace mysql
   {
+    enum class result_mode
+    {
+      buffered,  // the whole result is read into client memory before the first row is returned (default)
+      streamed,  // rows are read from the server one by one (mysql_use_result)
+    };
+
     class char_result_t
     {
       std::unique_ptr<detail::result_handle> _handle;
@@ -71,9 +77,15 @@ namespace sqlpp
         return _handle == rhs._handle;
       }
 
+      bool _zero_copy_results() const
+      {
+        return _handle and _handle->zero_copy_results;
+      }
+
+      // In streamed mode, this is the number of rows read so far
       size_t size() const
       {
-        return _handle ? mysql_num_rows(_handle->mysql_res) : size_t{};
+        return _handle and _handle->mysql_res ? mysql_num_rows(_handle->mysql_res) : size_t{};
       }
 
       template <typename ResultRow>
@@ -219,9 +231,21 @@ namespace sqlpp
         if (_handle->debug)
           std::cerr << "MySQL debug: Accessing next row of handle at " << _handle.get() << std::endl;
 
+        if (not _handle->mysql_res)
+          throw sqlpp::exception{"MySQL error: Could not fetch next row: the connection has been closed"};
+
         _char_result_row.data = const_cast<const char**>(mysql_fetch_row(_handle->mysql_res));
         _char_result_row.len = mysql_fetch_lengths(_handle->mysql_res);
 
+        if (not _char_result_row.data and _handle->connection_streamed_result)
+        {
+          // The result has been read completely, the connection can be used again
+          _handle->finish_streaming();
+          if (mysql_errno(_handle->streaming_connection))
+            throw sqlpp::exception{"MySQL error: Could not fetch next row: " +
+                                   std::string{mysql_error(_handle->streaming_connection)}};
+        }
+
         return _char_result_row.data;
       }
     };
@@ -28,9 +28,10 @@
  */
 
 #include <sqlpp11/connection.h>
-#include <sqlpp11/detail/float_safe_ostringstream.h>
+#include <sqlpp11/detail/serialization_buffer.h>
 #include <sqlpp11/exception.h>
 #include <sqlpp11/mysql/bind_result.h>
+#include <sqlpp11/mysql/bulk.h>
 #include <sqlpp11/mysql/char_result.h>
 #include <sqlpp11/mysql/connection_config.h>
 #include <sqlpp11/mysql/detail/connection_handle.h>
@@ -38,8 +39,10 @@
 #include <sqlpp11/mysql/remove.h>
 #include <sqlpp11/mysql/update.h>
 #include <sqlpp11/serialize.h>
+#include <sqlpp11/static_sql.h>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace sqlpp
 {
@@ -69,9 +72,20 @@ namespace sqlpp
         thread_local mysql_thread_initializer thread_initializer;
       }
 
+      // Statements cannot be executed while the rows of a result are still being streamed from the server
+      inline void validate_connection_idle(const std::unique_ptr<connection_handle>& handle)
+      {
+        if (handle->streamed_result)
+        {
+          throw sqlpp::exception{
+              "MySQL error: connection is busy streaming a result, read it completely or destroy it first"};
+        }
+      }
+
       inline void execute_statement(std::unique_ptr<connection_handle>& handle, const std::string& statement)
       {
         thread_init();
+        validate_connection_idle(handle);
 
         if (handle->config->debug)
           std::cerr << "MySQL debug: Executing: '" << statement << "'" << std::endl;
@@ -84,9 +98,11 @@ namespace sqlpp
         }
       }
 
-      inline void execute_prepared_statement(detail::prepared_statement_handle_t& prepared_statement)
+      inline void execute_prepared_statement(std::unique_ptr<connection_handle>& handle,
+                                             detail::prepared_statement_handle_t& prepared_statement)
       {
         thread_init();
+        validate_connection_idle(handle);
 
         if (prepared_statement.debug)
           std::cerr << "MySQL debug: Executing prepared_statement" << std::endl;
@@ -102,6 +118,26 @@ namespace sqlpp
           throw sqlpp::exception{std::string{"MySQL error: Could not execute prepared statement: "} +
                                  mysql_stmt_error(prepared_statement.mysql_stmt)};
         }
+
+        if (prepared_statement.store_results and mysql_stmt_field_count(prepared_statement.mysql_stmt) > 0)
+        {
+          if (mysql_stmt_store_result(prepared_statement.mysql_stmt))
+          {
+            throw sqlpp::exception{std::string{"MySQL error: Could not store result of prepared statement: "} +
+                                   mysql_stmt_error(prepared_statement.mysql_stmt)};
+          }
+        }
+      }
+
+      inline void set_statement_attribute(detail::prepared_statement_handle_t& prepared_statement,
+                                          enum_stmt_attr_type attribute,
+                                          const void* value)
+      {
+        if (mysql_stmt_attr_set(prepared_statement.mysql_stmt, attribute, value))
+        {
+          throw sqlpp::exception{std::string{"MySQL error: Could not set statement attribute: "} +
+                                 mysql_stmt_error(prepared_statement.mysql_stmt)};
+        }
       }
 
       inline std::shared_ptr<detail::prepared_statement_handle_t> prepare_statement(std::unique_ptr<connection_handle>& handle,
@@ -110,6 +146,7 @@ namespace sqlpp
                                                                              size_t no_of_columns)
       {
         thread_init();
+        validate_connection_idle(handle);
 
         if (handle->config->debug)
           std::cerr << "MySQL debug: Preparing: '" << statement << "'" << std::endl;
@@ -126,6 +163,23 @@ namespace sqlpp
               "MySQL error: Could not prepare statement: " + std::string{mysql_error(handle->native_handle())} +
               " (statement was >>" + statement + "<<\n"};
         }
+        prepared_statement->zero_copy_results = handle->config->zero_copy_results;
+        if (no_of_columns > 0)
+        {
+          if (handle->config->store_results)
+          {
+            // Lets the result metadata report the longest value of each column after mysql_stmt_store_result
+            const my_bool update_max_length = true;
+            set_statement_attribute(*prepared_statement, STMT_ATTR_UPDATE_MAX_LENGTH, &update_max_length);
+            prepared_statement->store_results = true;
+          }
+          else if (handle->config->prefetch_rows > 0)
+          {
+            const unsigned long cursor_type = CURSOR_TYPE_READ_ONLY;
+            set_statement_attribute(*prepared_statement, STMT_ATTR_CURSOR_TYPE, &cursor_type);
+            set_statement_attribute(*prepared_statement, STMT_ATTR_PREFETCH_ROWS, &handle->config->prefetch_rows);
+          }
+        }
 
         return prepared_statement;
       }
@@ -156,26 +210,26 @@ namespace sqlpp
 
     struct context_t
     {
-      context_t(const connection_base& db) : _db{db}
-      {
-      }
+      context_t(const connection_base& db);
       context_t(connection_base&&) = delete;
 
       template <typename T>
-      std::ostream& operator<<(T t)
+      sqlpp::detail::serialization_buffer& operator<<(T t)
       {
         return _os << t;
       }
 
       std::string escape(const std::string& arg) const;
 
-      std::string str() const
+      const std::string& str() const
       {
         return _os.str();
       }
 
       const connection_base& _db;
-      sqlpp::detail::float_safe_ostringstream _os;
+      sqlpp::detail::serialization_buffer _os;
+      // Offsets of the list parameters in the text, see serializer.h
+      std::vector<size_t> _list_parameter_positions;
     };
 
     std::integral_constant<char, '`'> get_quote_left(const context_t&);
@@ -185,19 +239,33 @@ namespace sqlpp
     class connection_base : public sqlpp::connection
     {
     private:
+      friend struct context_t;
+      // Reused by context_t for serializing statements
+      mutable std::string _serialization_buffer;
+
       bool _transaction_active{false};
+      result_mode _result_mode{result_mode::buffered};
 
       // direct execution
       char_result_t select_impl(const std::string& statement)
       {
         execute_statement(_handle, statement);
-        std::unique_ptr<detail::result_handle> result_handle(
-            new detail::result_handle(mysql_store_result(_handle->native_handle()), _handle->config->debug));
+        const bool streamed = _result_mode == result_mode::streamed;
+        std::unique_ptr<detail::result_handle> result_handle(new detail::result_handle(
+            streamed ? mysql_use_result(_handle->native_handle()) : mysql_store_result(_handle->native_handle()),
+            _handle->config->debug));
         if (!*result_handle)
         {
           throw sqlpp::exception{"MySQL error: Could not store result set: " +
                                  std::string{mysql_error(_handle->native_handle())}};
         }
+        result_handle->zero_copy_results = _handle->config->zero_copy_results;
+        if (streamed)
+        {
+          result_handle->streaming_connection = _handle->native_handle();
+          result_handle->connection_streamed_result = &_handle->streamed_result;
+          _handle->streamed_result = result_handle.get();
+        }
 
         return {std::move(result_handle)};
       }
@@ -222,32 +290,95 @@ namespace sqlpp
       }
 
       // prepared execution
+      prepared_statement_t prepare_impl(const std::string& statement,
+                                        const std::vector<size_t>& list_parameter_positions,
+                                        size_t no_of_parameters,
+                                        size_t no_of_columns)
+      {
+        if (list_parameter_positions.empty())
+        {
+          return prepare_impl(statement, no_of_parameters, no_of_columns);
+        }
+        // Prepared for the sizes of the lists when the statement is executed, see bind_params()
+        auto text_fragments = std::vector<std::string>{};
+        auto begin = size_t{0};
+        for (const auto position : list_parameter_positions)
+        {
+          text_fragments.push_back(statement.substr(begin, position - begin));
+          begin = position;
+        }
+        text_fragments.push_back(statement.substr(begin));
+        return {std::move(text_fragments), no_of_parameters, no_of_columns};
+      }
+
       prepared_statement_t prepare_impl(const std::string& statement, size_t no_of_parameters, size_t no_of_columns)
       {
-        return prepare_statement(_handle, statement, no_of_parameters, no_of_columns);
+        if (auto cached = _handle->statement_cache.get(statement))
+        {
+          return {std::move(cached)};
+        }
+        return {_handle->statement_cache.put(statement,
+                                             prepare_statement(_handle, statement, no_of_parameters, no_of_columns))};
+      }
+
+      // Binds the parameters. Statements with list parameters are prepared for the sizes of the lists first.
+      template <typename PreparedStatement>
+      void bind_params(const PreparedStatement& s)
+      {
+        auto& prepared_statement = s._prepared_statement;
+        if (not prepared_statement._text_fragments.empty())
+        {
+          detail::list_parameter_sizes_t lists;
+          s.params._bind(lists);
+          if (not prepared_statement._handle or lists.sizes != prepared_statement._lists.sizes)
+          {
+            // Lets the statement cache lend the current handle again
+            prepared_statement._handle.reset();
+            auto statement = prepared_statement._text_fragments.front();
+            auto no_of_parameters = prepared_statement._no_of_parameters;
+            for (size_t list = 0; list < lists.sizes.size(); ++list)
+            {
+              if (lists.sizes[list] == 0)
+              {
+                // IN() is not valid, an empty subquery is
+                statement += "SELECT NULL FROM DUAL WHERE FALSE";
+              }
+              for (size_t i = 0; i < lists.sizes[list]; ++i)
+              {
+                statement += (i == 0) ? "?" : ",?";
+              }
+              statement += prepared_statement._text_fragments[list + 1];
+              no_of_parameters = no_of_parameters + lists.sizes[list] - 1;
+            }
+            prepared_statement._handle =
+                prepare_impl(statement, no_of_parameters, prepared_statement._no_of_columns)._handle;
+            prepared_statement._lists = std::move(lists);
+          }
+        }
+        s._bind_params();
       }
 
       bind_result_t run_prepared_select_impl(prepared_statement_t& prepared_statement)
       {
-        execute_prepared_statement(*prepared_statement._handle);
+        execute_prepared_statement(_handle, *prepared_statement._handle);
         return prepared_statement._handle;
       }
 
       uint64_t run_prepared_insert_impl(prepared_statement_t& prepared_statement)
       {
-        execute_prepared_statement(*prepared_statement._handle);
+        execute_prepared_statement(_handle, *prepared_statement._handle);
         return mysql_stmt_insert_id(prepared_statement._handle->mysql_stmt);
       }
 
       uint64_t run_prepared_update_impl(prepared_statement_t& prepared_statement)
       {
-        execute_prepared_statement(*prepared_statement._handle);
+        execute_prepared_statement(_handle, *prepared_statement._handle);
         return mysql_stmt_affected_rows(prepared_statement._handle->mysql_stmt);
       }
 
       uint64_t run_prepared_remove_impl(prepared_statement_t& prepared_statement)
       {
-        execute_prepared_statement(*prepared_statement._handle);
+        execute_prepared_statement(_handle, *prepared_statement._handle);
         return mysql_stmt_affected_rows(prepared_statement._handle->mysql_stmt);
       }
 
@@ -297,22 +428,22 @@ namespace sqlpp
       char_result_t select(const Select& s)
       {
         _context_t context{*this};
-        serialize(s, context);
-        return select_impl(context.str());
+        return select_impl(serialize_statement(s, context));
       }
 
       template <typename Select>
       _prepared_statement_t prepare_select(Select& s)
       {
         _context_t context{*this};
-        serialize(s, context);
-        return prepare_impl(context.str(), s._get_no_of_parameters(), s.get_no_of_result_columns());
+        const auto& statement = serialize_statement(s, context);
+        return prepare_impl(statement, context._list_parameter_positions, s._get_no_of_parameters(),
+                            s.get_no_of_result_columns());
       }
 
       template <typename PreparedSelect>
       bind_result_t run_prepared_select(const PreparedSelect& s)
       {
-        s._bind_params();
+        bind_params(s);
         return run_prepared_select_impl(s._prepared_statement);
       }
 
@@ -321,22 +452,21 @@ namespace sqlpp
       size_t insert(const Insert& i)
       {
         _context_t context{*this};
-        serialize(i, context);
-        return insert_impl(context.str());
+        return insert_impl(serialize_statement(i, context));
       }
 
       template <typename Insert>
       _prepared_statement_t prepare_insert(Insert& i)
       {
         _context_t context{*this};
-        serialize(i, context);
-        return prepare_impl(context.str(), i._get_no_of_parameters(), 0);
+        const auto& statement = serialize_statement(i, context);
+        return prepare_impl(statement, context._list_parameter_positions, i._get_no_of_parameters(), 0);
       }
 
       template <typename PreparedInsert>
       size_t run_prepared_insert(const PreparedInsert& i)
       {
-        i._bind_params();
+        bind_params(i);
         return run_prepared_insert_impl(i._prepared_statement);
       }
 
@@ -345,22 +475,21 @@ namespace sqlpp
       size_t update(const Update& u)
       {
         _context_t context{*this};
-        serialize(u, context);
-        return update_impl(context.str());
+        return update_impl(serialize_statement(u, context));
       }
 
       template <typename Update>
       _prepared_statement_t prepare_update(Update& u)
       {
         _context_t context{*this};
-        serialize(u, context);
-        return prepare_impl(context.str(), u._get_no_of_parameters(), 0);
+        const auto& statement = serialize_statement(u, context);
+        return prepare_impl(statement, context._list_parameter_positions, u._get_no_of_parameters(), 0);
       }
 
       template <typename PreparedUpdate>
       size_t run_prepared_update(const PreparedUpdate& u)
       {
-        u._bind_params();
+        bind_params(u);
         return run_prepared_update_impl(u._prepared_statement);
       }
 
@@ -369,25 +498,62 @@ namespace sqlpp
       size_t remove(const Remove& r)
       {
         _context_t context{*this};
-        serialize(r, context);
-        return remove_impl(context.str());
+        return remove_impl(serialize_statement(r, context));
       }
 
       template <typename Remove>
       _prepared_statement_t prepare_remove(Remove& r)
       {
         _context_t context{*this};
-        serialize(r, context);
-        return prepare_impl(context.str(), r._get_no_of_parameters(), 0);
+        const auto& statement = serialize_statement(r, context);
+        return prepare_impl(statement, context._list_parameter_positions, r._get_no_of_parameters(), 0);
       }
 
       template <typename PreparedRemove>
       size_t run_prepared_remove(const PreparedRemove& r)
       {
-        r._bind_params();
+        bind_params(r);
         return run_prepared_remove_impl(r._prepared_statement);
       }
 
+      //! execute a prepared insert, update or remove once for each of the given parameter sets, e.g.
+      //!   auto prepared = db.prepare(insert_into(tab).set(tab.alpha = parameter(tab.alpha)));
+      //!   auto rows = std::vector<decltype(prepared.params)>(2);
+      //!   rows[0].alpha = 17;
+      //!   rows[1].alpha = 42;
+      //!   db.run_bulk(prepared, rows);
+      //! With MariaDB Connector/C, all parameter sets are sent in a single round trip (STMT_ATTR_ARRAY_SIZE) and only
+      //! the total number of affected rows is reported. Otherwise, the statement is executed once per parameter set.
+      template <typename PreparedStatement>
+      bulk_result_t run_bulk(const PreparedStatement& statement,
+                             const std::vector<typename PreparedStatement::_parameter_list_t>& rows)
+      {
+        bulk_result_t result;
+        if (rows.empty())
+          return result;
+
+        if (not statement._prepared_statement._text_fragments.empty())
+        {
+          throw sqlpp::exception{"MySQL: run_bulk() does not support list parameters"};
+        }
+        auto& prepared_statement = *statement._prepared_statement._handle;
+#if SQLPP_MYSQL_ARRAY_BINDING
+        detail::thread_init();
+        detail::validate_connection_idle(_handle);
+        result.affected_rows = detail::execute_bulk(prepared_statement, rows);
+#else
+        result.affected_rows_per_row.reserve(rows.size());
+        for (const auto& row : rows)
+        {
+          row._bind(statement._prepared_statement);
+          detail::execute_prepared_statement(_handle, prepared_statement);
+          result.affected_rows_per_row.push_back(mysql_stmt_affected_rows(prepared_statement.mysql_stmt));
+          result.affected_rows += result.affected_rows_per_row.back();
+        }
+#endif
+        return result;
+      }
+
       //! Execute arbitrary statement (e.g. create a table).
       //! Essentially this calls mysql_query, see https://dev.mysql.com/doc/c-api/8.0/en/mysql-query.html
       //! Note:
@@ -409,8 +575,7 @@ namespace sqlpp
         static_assert(not sqlpp::is_select_t<Execute>::value, "argument must not be a select statement - use operator() instead");
 
         _context_t context{*this};
-        serialize(x, context);
-        return execute(context.str());
+        return execute(serialize_statement(x, context));
       }
 
       template <
@@ -446,6 +611,13 @@ namespace sqlpp
         return t._run(*this);
       }
 
+      // Statements that change when they are run, e.g. prepared batch inserts
+      template <typename T>
+      auto _run(T& t, ::sqlpp::consistent_t) -> decltype(t._run(*this))
+      {
+        return t._run(*this);
+      }
+
       template <typename Check, typename T>
       auto _run(const T& t, Check) -> Check;
 
@@ -455,6 +627,12 @@ namespace sqlpp
         return _run(t, sqlpp::run_check_t<_serializer_context_t, T>{});
       }
 
+      template <typename T>
+      auto operator()(T& t) -> decltype(this->_run(t, sqlpp::run_check_t<_serializer_context_t, T>{}))
+      {
+        return _run(t, sqlpp::run_check_t<_serializer_context_t, T>{});
+      }
+
       //! call prepare on the argument
       template <typename T>
       auto _prepare(const T& t, ::sqlpp::consistent_t) -> decltype(t._prepare(*this))
@@ -520,6 +698,26 @@ namespace sqlpp
         return _transaction_active;
       }
 
+      //! choose how the rows of subsequent direct (i.e. not prepared) selects are transferred from the server, see
+      //! result_mode. In streamed mode, no other statement can be executed on this connection until the result has been
+      //! read completely or destroyed. If the connection is closed first, the remaining rows are discarded and reading
+      //! further rows from the result throws.
+      void set_result_mode(result_mode mode)
+      {
+        _result_mode = mode;
+      }
+
+      result_mode get_result_mode() const
+      {
+        return _result_mode;
+      }
+
+      //! hits and misses of prepare() in the statement cache, see connection_config::statement_cache_size
+      sqlpp::statement_cache_stats get_statement_cache_stats() const
+      {
+        return _handle->statement_cache.stats();
+      }
+
       MYSQL* native_handle()
       {
         return _handle->native_handle();
@@ -541,7 +739,11 @@ namespace sqlpp
       }
     };
 
-    // Method definition moved outside of class because it needs connection_base
+    // Method definitions moved outside of class because they need connection_base
+    inline context_t::context_t(const connection_base& db) : _db(db), _os(db._serialization_buffer)
+    {
+    }
+
     inline std::string context_t::escape(const std::string& arg) const
     {
       return _db.escape(arg);
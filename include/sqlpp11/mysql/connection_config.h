@@ -47,6 +47,10 @@ namespace sqlpp
       bool ssl{false};
       std::string ssl_key, ssl_cert, ssl_ca, ssl_capath, ssl_cipher;
       unsigned int read_timeout{0};
+      size_t statement_cache_size{0};  // prepared statements kept per connection for reuse by prepare(), 0 = disabled
+      bool zero_copy_results{false};   // text and blob result fields point into the result instead of copying it
+      bool store_results{false};       // prepared selects buffer the whole result on the client (mysql_stmt_store_result)
+      unsigned long prefetch_rows{0};  // rows per round trip through a read-only cursor, 0 = no cursor
 
       bool operator==(const connection_config& other) const
       {
@@ -55,7 +59,9 @@ namespace sqlpp
                 other.connect_timeout_seconds == connect_timeout_seconds and other.ssl == ssl and
                 other.ssl_key == ssl_key and other.ssl_cert == ssl_cert and other.ssl_ca == ssl_ca and
                 other.ssl_capath == ssl_capath and other.ssl_cipher == ssl_cipher and
-                other.read_timeout == read_timeout);
+                other.read_timeout == read_timeout and other.statement_cache_size == statement_cache_size and
+                other.zero_copy_results == zero_copy_results and other.store_results == store_results and
+                other.prefetch_rows == prefetch_rows);
       }
 
       bool operator!=(const connection_config& other) const
@@ -27,8 +27,10 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sqlpp11/detail/statement_cache.h>
 #include <sqlpp11/mysql/connection_config.h>
 #include <sqlpp11/mysql/sqlpp_mysql.h>
+#include <sqlpp11/mysql/detail/result_handle.h>
 
 #include <memory>
 
@@ -95,14 +97,21 @@ namespace sqlpp
         }
       }
 
+      struct prepared_statement_handle_t;
+
       struct connection_handle
       {
         std::shared_ptr<const connection_config> config;
         std::unique_ptr<MYSQL, void (STDCALL*)(MYSQL*)> mysql;
+        // Prepared statements for reuse by prepare(), closed before the connection
+        sqlpp::detail::statement_cache<prepared_statement_handle_t> statement_cache;
+        // Set while a streamed result is read, no other statement can be executed until then
+        result_handle* streamed_result = nullptr;
 
         connection_handle(const std::shared_ptr<const connection_config>& conf) :
           config{conf},
-          mysql{mysql_init(nullptr), mysql_close}
+          mysql{mysql_init(nullptr), mysql_close},
+          statement_cache{conf->statement_cache_size}
         {
           if (not mysql)
           {
@@ -112,10 +121,18 @@ namespace sqlpp
           connect(native_handle(), *config);
         }
 
+        // A streamed result points back at its connection handle, which therefore cannot be moved
         connection_handle(const connection_handle&) = delete;
-        connection_handle(connection_handle&&) = default;
+        connection_handle(connection_handle&&) = delete;
         connection_handle& operator=(const connection_handle&) = delete;
-        connection_handle& operator=(connection_handle&&) = default;
+        connection_handle& operator=(connection_handle&&) = delete;
+
+        ~connection_handle()
+        {
+          // A result that outlives its connection cannot read any more rows
+          if (streamed_result)
+            streamed_result->abandon_streaming();
+        }
 
         MYSQL* native_handle() const
         {
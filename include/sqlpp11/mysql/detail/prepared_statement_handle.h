@@ -36,6 +36,9 @@ namespace sqlpp
   {
     namespace detail
     {
+      // Upper bound for the initial size of text and blob result buffers when the column's actual maximum is unknown
+      constexpr unsigned long max_initial_result_buffer_size = 1024;
+
       struct result_meta_data_t
       {
         size_t index;
@@ -43,6 +46,7 @@ namespace sqlpp
         my_bool bound_is_null;
         my_bool bound_error;
         std::vector<char> bound_text_buffer;  // also for blobs
+        unsigned long text_buffer_size_hint;  // initial size of bound_text_buffer, taken from the result metadata
         const char** text_buffer;
         size_t* len;
         bool* is_null;
@@ -74,6 +78,9 @@ namespace sqlpp
         std::vector<MYSQL_BIND> result_params;
         std::vector<result_meta_data_t> result_param_meta_data;
         bool debug;
+        bool zero_copy_results = false;
+        bool store_results = false;
+        bool result_buffers_sized = false;
 
         prepared_statement_handle_t(MYSQL_STMT* stmt, size_t no_of_parameters, size_t no_of_columns, bool debug_)
             : mysql_stmt(stmt),
@@ -101,6 +108,13 @@ namespace sqlpp
         {
           return !mysql_stmt;
         }
+
+        // Called by the statement cache when the statement is not used anymore
+        void recycle()
+        {
+          if (mysql_stmt)
+            mysql_stmt_free_result(mysql_stmt);
+        }
       };
     }  // namespace detail
   }  // namespace mysql
@@ -36,6 +36,11 @@ namespace sqlpp
       {
         MYSQL_RES* mysql_res;
         bool debug;
+        bool zero_copy_results = false;
+        // Set while the rows are read from the server one by one (mysql_use_result). The connection handle points
+        // back at this result, so that it can finish reading it if the connection is closed first.
+        MYSQL* streaming_connection = nullptr;
+        result_handle** connection_streamed_result = nullptr;
 
         result_handle(MYSQL_RES* res, bool debug_) : mysql_res{res}, debug{debug_}
         {
@@ -48,8 +53,26 @@ namespace sqlpp
 
         ~result_handle()
         {
+          if (mysql_res)
+            mysql_free_result(mysql_res);  // also reads and discards remaining rows of a streamed result
+          finish_streaming();
+        }
+
+        void finish_streaming()
+        {
+          if (connection_streamed_result)
+            *connection_streamed_result = nullptr;
+          connection_streamed_result = nullptr;
+        }
+
+        // Called by the connection handle before it closes the connection. Remaining rows are discarded.
+        void abandon_streaming()
+        {
+          finish_streaming();
           if (mysql_res)
             mysql_free_result(mysql_res);
+          mysql_res = nullptr;
+          streaming_connection = nullptr;
         }
 
         bool operator!() const
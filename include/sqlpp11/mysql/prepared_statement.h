@@ -30,21 +30,130 @@
 
 #include <sqlpp11/mysql/sqlpp_mysql.h>
 #include <sqlpp11/mysql/bind_result.h>
+#include <algorithm>
 #include <memory>
 #include <iostream>
 #include <string>
+#include <vector>
 #include <sqlpp11/chrono.h>
+#include <sqlpp11/wrong.h>
 
 namespace sqlpp
 {
   namespace mysql
   {
+    namespace detail
+    {
+      inline void to_mysql_time(MYSQL_TIME& bound_time, const ::sqlpp::chrono::day_point& value)
+      {
+        const auto ymd = ::date::year_month_day{value};
+        bound_time.year = static_cast<unsigned>(std::abs(static_cast<int>(ymd.year())));
+        bound_time.month = static_cast<unsigned>(ymd.month());
+        bound_time.day = static_cast<unsigned>(ymd.day());
+        bound_time.hour = 0u;
+        bound_time.minute = 0u;
+        bound_time.second = 0u;
+        bound_time.second_part = 0u;
+      }
+
+      inline void to_mysql_time(MYSQL_TIME& bound_time, const ::sqlpp::chrono::microsecond_point& value)
+      {
+        const auto dp = ::sqlpp::chrono::floor<::date::days>(value);
+        const auto time = ::date::make_time(value - dp);
+        const auto ymd = ::date::year_month_day{dp};
+        bound_time.year = static_cast<unsigned>(std::abs(static_cast<int>(ymd.year())));
+        bound_time.month = static_cast<unsigned>(ymd.month());
+        bound_time.day = static_cast<unsigned>(ymd.day());
+        bound_time.hour = static_cast<unsigned>(time.hours().count());
+        bound_time.minute = static_cast<unsigned>(time.minutes().count());
+        bound_time.second = static_cast<unsigned>(time.seconds().count());
+        bound_time.second_part = static_cast<unsigned long>(time.subseconds().count());
+      }
+
+      inline void to_mysql_time(MYSQL_TIME& bound_time, const ::std::chrono::microseconds& value)
+      {
+        const auto time = ::date::make_time(value);
+        bound_time.year = 0u;
+        bound_time.month = 0u;
+        bound_time.day = 0u;
+        bound_time.hour = static_cast<unsigned>(time.hours().count());
+        bound_time.minute = static_cast<unsigned>(time.minutes().count());
+        bound_time.second = static_cast<unsigned>(time.seconds().count());
+        bound_time.second_part = static_cast<unsigned long>(time.subseconds().count());
+      }
+
+      // Collects the list parameters of a statement and the number of placeholders for each, which is the size of the
+      // list, rounded up to a power of two. That way, lists of similar size share a prepared statement.
+      struct list_parameter_sizes_t
+      {
+        std::vector<size_t> indexes;
+        std::vector<size_t> sizes;
+
+        template <typename T>
+        void _bind_list_parameter(size_t index, const std::vector<T>* values)
+        {
+          auto size = size_t{values->empty() ? 0u : 1u};
+          while (size < values->size())
+          {
+            size *= 2;
+          }
+          indexes.push_back(index);
+          sizes.push_back(size);
+        }
+
+        template <typename... Args>
+        void _bind_boolean_parameter(Args&&...)
+        {
+        }
+
+        template <typename... Args>
+        void _bind_integral_parameter(Args&&...)
+        {
+        }
+
+        template <typename... Args>
+        void _bind_unsigned_integral_parameter(Args&&...)
+        {
+        }
+
+        template <typename... Args>
+        void _bind_floating_point_parameter(Args&&...)
+        {
+        }
+
+        template <typename... Args>
+        void _bind_text_parameter(Args&&...)
+        {
+        }
+
+        template <typename... Args>
+        void _bind_date_parameter(Args&&...)
+        {
+        }
+
+        template <typename... Args>
+        void _bind_date_time_parameter(Args&&...)
+        {
+        }
+
+        template <typename... Args>
+        void _bind_time_of_day_parameter(Args&&...)
+        {
+        }
+      };
+    }  // namespace detail
+
     class connection_base;
 
     class prepared_statement_t
     {
       friend ::sqlpp::mysql::connection_base;
       std::shared_ptr<detail::prepared_statement_handle_t> _handle;
+      // Statements with list parameters are prepared when they are executed, once per combination of list sizes
+      std::vector<std::string> _text_fragments;  // the statement text around the list parameters
+      size_t _no_of_parameters = 0;
+      size_t _no_of_columns = 0;
+      detail::list_parameter_sizes_t _lists;  // of the current _handle
 
     public:
       prepared_statement_t() = delete;
@@ -54,6 +163,13 @@ namespace sqlpp
           std::cerr << "MySQL debug: Constructing prepared_statement, using handle at " << _handle.get() << std::endl;
       }
 
+      prepared_statement_t(std::vector<std::string> text_fragments, size_t no_of_parameters, size_t no_of_columns)
+          : _text_fragments{std::move(text_fragments)},
+            _no_of_parameters{no_of_parameters},
+            _no_of_columns{no_of_columns}
+      {
+      }
+
       prepared_statement_t(const prepared_statement_t&) = delete;
       prepared_statement_t(prepared_statement_t&& rhs) = default;
       prepared_statement_t& operator=(const prepared_statement_t&) = delete;
@@ -69,6 +185,7 @@ namespace sqlpp
 
       void _bind_boolean_parameter(size_t index, const signed char* value, bool is_null)
       {
+        index = _physical_index(index);
         if (_handle->debug)
           std::cerr << "MySQL debug: binding boolean parameter " << (*value ? "true" : "false")
                     << " at index: " << index << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
@@ -85,6 +202,7 @@ namespace sqlpp
 
       void _bind_integral_parameter(size_t index, const int64_t* value, bool is_null)
       {
+        index = _physical_index(index);
         if (_handle->debug)
           std::cerr << "MySQL debug: binding integral parameter " << *value << " at index: " << index << ", being "
                     << (is_null ? "" : "not ") << "null" << std::endl;
@@ -101,6 +219,7 @@ namespace sqlpp
 
       void _bind_unsigned_integral_parameter(size_t index, const uint64_t* value, bool is_null)
       {
+        index = _physical_index(index);
         if (_handle->debug)
           std::cerr << "MySQL debug: binding unsigned integral parameter " << *value << " at index: " << index
                     << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
@@ -117,6 +236,7 @@ namespace sqlpp
 
       void _bind_floating_point_parameter(size_t index, const double* value, bool is_null)
       {
+        index = _physical_index(index);
         if (_handle->debug)
           std::cerr << "MySQL debug: binding floating_point parameter " << *value << " at index: " << index
                     << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
@@ -133,6 +253,7 @@ namespace sqlpp
 
       void _bind_text_parameter(size_t index, const std::string* value, bool is_null)
       {
+        index = _physical_index(index);
         if (_handle->debug)
           std::cerr << "MySQL debug: binding text parameter " << *value << " at index: " << index << ", being "
                     << (is_null ? "" : "not ") << "null" << std::endl;
@@ -149,6 +270,7 @@ namespace sqlpp
 
       void _bind_date_parameter(size_t index, const ::sqlpp::chrono::day_point* value, bool is_null)
       {
+        index = _physical_index(index);
         if (_handle->debug)
           std::cerr << "MySQL debug: binding date parameter "
                     << " at index: " << index << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
@@ -156,14 +278,7 @@ namespace sqlpp
         auto& bound_time = _handle->stmt_date_time_param_buffer[index];
         if (not is_null)
         {
-          const auto ymd = ::date::year_month_day{*value};
-          bound_time.year = static_cast<unsigned>(std::abs(static_cast<int>(ymd.year())));
-          bound_time.month = static_cast<unsigned>(ymd.month());
-          bound_time.day = static_cast<unsigned>(ymd.day());
-          bound_time.hour = 0u;
-          bound_time.minute = 0u;
-          bound_time.second = 0u;
-          bound_time.second_part = 0u;
+          detail::to_mysql_time(bound_time, *value);
           if (_handle->debug)
             std::cerr << "bound values: " << bound_time.year << '-' << bound_time.month << '-' << bound_time.day << 'T'
                       << bound_time.hour << ':' << bound_time.minute << ':' << bound_time.second << std::endl;
@@ -182,6 +297,7 @@ namespace sqlpp
 
       void _bind_date_time_parameter(size_t index, const ::sqlpp::chrono::microsecond_point* value, bool is_null)
       {
+        index = _physical_index(index);
         if (_handle->debug)
           std::cerr << "MySQL debug: binding date_time parameter "
                     << " at index: " << index << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
@@ -189,16 +305,7 @@ namespace sqlpp
         auto& bound_time = _handle->stmt_date_time_param_buffer[index];
         if (not is_null)
         {
-          const auto dp = ::sqlpp::chrono::floor<::date::days>(*value);
-          const auto time = ::date::make_time(*value - dp);
-          const auto ymd = ::date::year_month_day{dp};
-          bound_time.year = static_cast<unsigned>(std::abs(static_cast<int>(ymd.year())));
-          bound_time.month = static_cast<unsigned>(ymd.month());
-          bound_time.day = static_cast<unsigned>(ymd.day());
-          bound_time.hour = static_cast<unsigned>(time.hours().count());
-          bound_time.minute = static_cast<unsigned>(time.minutes().count());
-          bound_time.second = static_cast<unsigned>(time.seconds().count());
-          bound_time.second_part = static_cast<unsigned long>(time.subseconds().count());
+          detail::to_mysql_time(bound_time, *value);
           if (_handle->debug)
             std::cerr << "bound values: " << bound_time.year << '-' << bound_time.month << '-' << bound_time.day << 'T'
                       << bound_time.hour << ':' << bound_time.minute << ':' << bound_time.second << std::endl;
@@ -217,6 +324,7 @@ namespace sqlpp
 
       void _bind_time_of_day_parameter(size_t index, const ::std::chrono::microseconds* value, bool is_null)
       {
+        index = _physical_index(index);
         if (_handle->debug)
           std::cerr << "MySQL debug: binding time_of_day parameter "
                     << " at index: " << index << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
@@ -224,14 +332,7 @@ namespace sqlpp
         auto& bound_time = _handle->stmt_date_time_param_buffer[index];
         if (not is_null)
         {
-          const auto time = ::date::make_time(*value);
-          bound_time.year = 0u;
-          bound_time.month = 0u;
-          bound_time.day = 0u;
-          bound_time.hour = static_cast<unsigned>(time.hours().count());
-          bound_time.minute = static_cast<unsigned>(time.minutes().count());
-          bound_time.second = static_cast<unsigned>(time.seconds().count());
-          bound_time.second_part = static_cast<unsigned long>(time.subseconds().count());
+          detail::to_mysql_time(bound_time, *value);
           if (_handle->debug)
             std::cerr << "bound values: " << bound_time.hour << ':' << bound_time.minute << ':' << bound_time.second
                       << '.' << bound_time.second_part << std::endl;
@@ -247,6 +348,72 @@ namespace sqlpp
         param.is_unsigned = false;
         param.error = nullptr;
       }
+
+      // Each list parameter is bound to its placeholders. Padding placeholders repeat the last value.
+      template <typename T>
+      void _bind_list_parameter(size_t index, const std::vector<T>* values)
+      {
+        const auto list =
+            static_cast<size_t>(std::find(_lists.indexes.begin(), _lists.indexes.end(), index) - _lists.indexes.begin());
+        const auto first = _physical_index(index);
+        for (size_t i = 0; i < _lists.sizes[list]; ++i)
+        {
+          _bind_list_element(first + i, (*values)[std::min(i, values->size() - 1)]);
+        }
+      }
+
+    private:
+      // Parameters following a list parameter are shifted by its placeholders
+      size_t _physical_index(size_t index) const
+      {
+        for (size_t list = 0; list < _lists.indexes.size() and _lists.indexes[list] < index; ++list)
+        {
+          index = index + _lists.sizes[list] - 1;
+        }
+        return index;
+      }
+
+      void _bind_list_element(size_t index, const int64_t& value)
+      {
+        _bind_list_element(index, MYSQL_TYPE_LONGLONG, &value, sizeof(value), false);
+      }
+
+      void _bind_list_element(size_t index, const uint64_t& value)
+      {
+        _bind_list_element(index, MYSQL_TYPE_LONGLONG, &value, sizeof(value), true);
+      }
+
+      void _bind_list_element(size_t index, const double& value)
+      {
+        _bind_list_element(index, MYSQL_TYPE_DOUBLE, &value, sizeof(value), false);
+      }
+
+      void _bind_list_element(size_t index, const std::string& value)
+      {
+        _bind_list_element(index, MYSQL_TYPE_STRING, value.data(), value.size(), false);
+      }
+
+      template <typename T>
+      void _bind_list_element(size_t, const T&)
+      {
+        static_assert(wrong_t<T>::value, "MySQL: list_parameter() supports integral, floating point and text values only");
+      }
+
+      void _bind_list_element(
+          size_t index, enum_field_types type, const void* value, unsigned long length, bool is_unsigned)
+      {
+        if (_handle->debug)
+          std::cerr << "MySQL debug: binding list element at index: " << index << std::endl;
+        _handle->stmt_param_is_null[index] = false;
+        MYSQL_BIND& param{_handle->stmt_params[index]};
+        param.buffer_type = type;
+        param.buffer = const_cast<void*>(value);
+        param.buffer_length = length;
+        param.length = &param.buffer_length;
+        param.is_null = &_handle->stmt_param_is_null[index].value;
+        param.is_unsigned = is_unsigned;
+        param.error = nullptr;
+      }
     };
   }  // namespace mysql
 }  // namespace sqlpp
@@ -28,6 +28,7 @@
 
 #include <sqlpp11/data_types/text/concat.h>
 #include <sqlpp11/insert_value_list.h>
+#include <sqlpp11/list_parameter.h>
 
 namespace sqlpp
 {
@@ -45,4 +46,26 @@ namespace sqlpp
     ctx << " () VALUES()";
     return ctx;
   }
+
+  // Prepared statements have a fixed number of parameters. The list is therefore replaced by placeholders when the
+  // statement is executed, their number is the list size rounded up to a power of two, see connection_base::bind_params()
+  template <typename Operand, typename ValueType, typename NameType>
+  mysql::context_t& serialize(const in_t<Operand, list_parameter_t<ValueType, NameType>>& t, mysql::context_t& ctx)
+  {
+    serialize_operand(t._operand, ctx);
+    ctx << " IN(";
+    ctx._list_parameter_positions.push_back(ctx.str().size());
+    ctx << ')';
+    return ctx;
+  }
+
+  template <typename Operand, typename ValueType, typename NameType>
+  mysql::context_t& serialize(const not_in_t<Operand, list_parameter_t<ValueType, NameType>>& t, mysql::context_t& ctx)
+  {
+    serialize_operand(t._operand, ctx);
+    ctx << " NOT IN(";
+    ctx._list_parameter_positions.push_back(ctx.str().size());
+    ctx << ')';
+    return ctx;
+  }
 }
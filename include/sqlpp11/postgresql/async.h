@@ -0,0 +1,546 @@
+#pragma once
+
+/**
+ * Copyright © 2014-2015, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <sqlpp11/compat/sqlpp_cxx_std.h>
+#include <sqlpp11/postgresql/connection.h>
+#include <sqlpp11/prepared_select.h>
+
+#if SQLPP_CXX_STD >= 202002L
+#include <coroutine>
+#include <utility>
+#endif
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+
+    // What db(statement) returns: a result_t for selects, the number of affected rows otherwise
+    template <typename Statement>
+    using async_result_t = decltype(std::declval<connection_base&>()(std::declval<const Statement&>()));
+
+    namespace detail
+    {
+      // A statement waiting to be sent or for its result
+      struct async_statement_t
+      {
+        std::string query;  // sent as is, unless prepared is set
+        std::shared_ptr<prepared_statement_handle_t> prepared;
+        // The parameters of the prepared statement at the time it was queued
+        std::vector<bool> null_values;
+        std::vector<std::string> param_values;
+        std::function<void(const std::shared_ptr<statement_handle_t>&, std::exception_ptr)> complete;
+      };
+
+      template <typename Statement>
+      auto async_dynamic_names(const Statement& statement) ->
+          typename std::decay<decltype(statement.get_dynamic_names())>::type
+      {
+        return statement.get_dynamic_names();
+      }
+
+      template <typename Db, typename Statement, typename Composite>
+      auto async_dynamic_names(const prepared_select_t<Db, Statement, Composite>& statement) ->
+          typename prepared_select_t<Db, Statement, Composite>::_dynamic_names_t
+      {
+        return statement._dynamic_names;
+      }
+
+      // Turns the result of a statement into what db(statement) would have returned
+      template <typename Statement, typename Result = async_result_t<Statement>>
+      struct make_async_result_t
+      {
+        typename std::decay<decltype(async_dynamic_names(std::declval<const Statement&>()))>::type _dynamic_names;
+
+        explicit make_async_result_t(const Statement& statement) : _dynamic_names(async_dynamic_names(statement))
+        {
+        }
+
+        Result operator()(const std::shared_ptr<statement_handle_t>& handle) const
+        {
+          return {bind_result_t{handle}, _dynamic_names};
+        }
+      };
+
+      template <typename Statement>
+      struct make_async_result_t<Statement, size_t>
+      {
+        explicit make_async_result_t(const Statement&)
+        {
+        }
+
+        size_t operator()(const std::shared_ptr<statement_handle_t>& handle) const
+        {
+          return static_cast<size_t>(handle->result.affected_rows());
+        }
+      };
+    }  // namespace detail
+
+#if SQLPP_CXX_STD >= 202002L
+    class async_executor;
+
+    // Returned by async_executor::operator(), co_await suspends the coroutine until the statement is complete
+    template <typename Statement>
+    class statement_awaitable
+    {
+    public:
+      statement_awaitable(async_executor& executor, const Statement& statement)
+          : _executor(executor), _statement(statement)
+      {
+      }
+
+      bool await_ready() const noexcept
+      {
+        return false;
+      }
+
+      void await_suspend(std::coroutine_handle<> coroutine);
+
+      async_result_t<Statement> await_resume()
+      {
+        if (_error)
+        {
+          std::rethrow_exception(_error);
+        }
+        return std::move(_result);
+      }
+
+    private:
+      async_executor& _executor;
+      Statement _statement;
+      std::exception_ptr _error;
+      async_result_t<Statement> _result{};
+    };
+
+    // A coroutine that runs until its first co_await right away and is resumed by whoever processes the executor,
+    // e.g. an epoll_loop. It has to stay alive until it is done.
+    class task
+    {
+    public:
+      struct promise_type
+      {
+        std::exception_ptr error;
+
+        task get_return_object()
+        {
+          return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+          return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+          return {};
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+          error = std::current_exception();
+        }
+      };
+
+      task(const task&) = delete;
+      task(task&& rhs) noexcept : _coroutine(std::exchange(rhs._coroutine, {}))
+      {
+      }
+      task& operator=(const task&) = delete;
+      task& operator=(task&&) = delete;
+
+      ~task()
+      {
+        if (_coroutine)
+        {
+          _coroutine.destroy();
+        }
+      }
+
+      bool done() const
+      {
+        return not _coroutine or _coroutine.done();
+      }
+
+      // Rethrows the exception that ended the coroutine (if any)
+      void get() const
+      {
+        if (_coroutine and _coroutine.promise().error)
+        {
+          std::rethrow_exception(_coroutine.promise().error);
+        }
+      }
+
+    private:
+      explicit task(std::coroutine_handle<promise_type> coroutine) : _coroutine(coroutine)
+      {
+      }
+
+      std::coroutine_handle<promise_type> _coroutine;
+    };
+#endif
+
+    // Executes statements without blocking the calling thread, e.g. in an event loop:
+    //
+    //   sqlpp::postgresql::async_executor executor{db};
+    //   executor.send(select(all_of(tab)).from(tab).unconditionally(),
+    //                 [](std::exception_ptr error, sqlpp::postgresql::async_result_t<...> result) { ... });
+    //   auto count = executor.send(remove_from(tab).where(tab.alpha == 17));  // std::future<size_t>
+    //
+    //   // whenever socket() is readable (or writable, if wants_write())
+    //   executor.process();
+    //
+    // Results are of the same type as db(statement) returns. The server executes one statement at a time, so
+    // statements are queued and the next one is sent when the previous one is complete. Callbacks are called by
+    // process() (or wait()), exceptions thrown by them are passed on to the caller. Prepared statements are queued
+    // with their current parameters.
+    //
+    // With C++20, coroutines can co_await executor(statement) instead, see also epoll_loop.h:
+    //
+    //   sqlpp::postgresql::task count_rows(sqlpp::postgresql::async_executor& executor)
+    //   {
+    //     const auto& row = (co_await executor(select(count(tab.alpha)).from(tab).unconditionally())).front();
+    //     ...
+    //   }
+    //
+    // No other statements can be executed on the connection while the executor exists. Destroying the executor waits
+    // for all queued statements.
+    class async_executor
+    {
+    public:
+      explicit async_executor(connection_base& db) : _db(db)
+      {
+        _db.validate_connection_idle();
+        _was_nonblocking = PQisnonblocking(native_handle()) == 1;
+        if (PQsetnonblocking(native_handle(), 1) != 0)
+        {
+          throw failure{std::string{PQerrorMessage(native_handle())}};
+        }
+        _db._handle->async = true;
+      }
+
+      async_executor(const async_executor&) = delete;
+      async_executor(async_executor&&) = delete;
+      async_executor& operator=(const async_executor&) = delete;
+      async_executor& operator=(async_executor&&) = delete;
+
+      ~async_executor()
+      {
+        try
+        {
+          wait();
+        }
+        catch (const std::exception& e)
+        {
+          std::cerr << "PostgreSQL error: could not complete asynchronous statements: " << e.what() << std::endl;
+        }
+        PQclear(_result);
+        PQsetnonblocking(native_handle(), _was_nonblocking ? 1 : 0);
+        _db._handle->async = false;
+      }
+
+      // Queues a statement, the callback is called as callback(std::exception_ptr, async_result_t<Statement>)
+      template <typename Statement, typename Callback>
+      void send(const Statement& statement, Callback callback)
+      {
+        sqlpp::run_check_t<context_t, Statement>::verify();
+        using result_type = async_result_t<Statement>;
+        const auto make_result = detail::make_async_result_t<Statement>{statement};
+
+        auto queued = detail::async_statement_t{};
+        prepare(statement, queued, sqlpp::is_prepared_statement_t<Statement>{});
+        queued.complete = [make_result, callback](const std::shared_ptr<detail::statement_handle_t>& handle,
+                                                  std::exception_ptr error) mutable
+        {
+          auto result = result_type{};
+          if (not error)
+          {
+            try
+            {
+              result = make_result(handle);
+            }
+            catch (const std::exception&)
+            {
+              error = std::current_exception();
+            }
+          }
+          callback(error, std::move(result));
+        };
+        _queue.push_back(std::move(queued));
+        if (not _sent)
+        {
+          send_next();
+        }
+      }
+
+      // Queues a statement, the future is ready once process() or wait() has read its result
+      template <typename Statement>
+      std::future<async_result_t<Statement>> send(const Statement& statement)
+      {
+        using result_type = async_result_t<Statement>;
+        auto promise = std::make_shared<std::promise<result_type>>();
+        auto future = promise->get_future();
+        send(statement, [promise](std::exception_ptr error, result_type result) {
+          if (error)
+          {
+            promise->set_exception(error);
+          }
+          else
+          {
+            promise->set_value(std::move(result));
+          }
+        });
+        return future;
+      }
+
+#if SQLPP_CXX_STD >= 202002L
+      // co_await executor(statement) resumes the coroutine with the result once the statement is complete
+      template <typename Statement>
+      statement_awaitable<Statement> operator()(const Statement& statement)
+      {
+        return {*this, statement};
+      }
+#endif
+
+      // The connection's socket, for waiting on with select, poll, epoll, etc.
+      int socket() const
+      {
+        return PQsocket(native_handle());
+      }
+
+      // True if a statement has not been sent completely yet, process() should be called once the socket is writable
+      bool wants_write() const
+      {
+        return _flushing;
+      }
+
+      // Number of statements that have not been completed yet
+      size_t pending() const
+      {
+        return _queue.size();
+      }
+
+      // Sends and reads whatever is possible without blocking and completes the statements whose results have
+      // arrived. Returns the number of completed statements.
+      size_t process()
+      {
+        if (_flushing)
+        {
+          flush();
+        }
+        if (PQconsumeInput(native_handle()) != 1)
+        {
+          throw broken_connection{std::string{PQerrorMessage(native_handle())}};
+        }
+        return read_results(false);
+      }
+
+      // Blocks until all queued statements are complete
+      void wait()
+      {
+        read_results(true);
+      }
+
+    private:
+      connection_base& _db;
+      bool _was_nonblocking{false};
+      std::deque<detail::async_statement_t> _queue;
+      bool _sent{false};  // the front of the queue has been sent
+      bool _flushing{false};
+      PGresult* _result{nullptr};  // of the statement that has been sent
+
+      PGconn* native_handle() const
+      {
+        return _db.native_handle();
+      }
+
+      template <typename Statement>
+      void prepare(const Statement& statement, detail::async_statement_t& queued, const std::true_type&)
+      {
+        statement._bind_params();
+        queued.prepared = statement._prepared_statement._handle;
+        queued.null_values = queued.prepared->null_values;
+        queued.param_values = queued.prepared->param_values;
+      }
+
+      template <typename Statement>
+      void prepare(const Statement& statement, detail::async_statement_t& queued, const std::false_type&)
+      {
+        context_t context{_db};
+        queued.query = serialize_statement(statement, context);
+      }
+
+      void flush()
+      {
+        const auto rc = PQflush(native_handle());
+        if (rc < 0)
+        {
+          throw broken_connection{std::string{PQerrorMessage(native_handle())}};
+        }
+        _flushing = rc == 1;
+      }
+
+      // Sends the statement at the front of the queue. Statements that cannot be sent are completed with an error.
+      // Does not throw, so that the statements in the queue are completed in any case.
+      void send_next()
+      {
+        while (not _sent and not _queue.empty())
+        {
+          auto& next = _queue.front();
+          try
+          {
+            if (_db._handle->config->debug)
+            {
+              std::cerr << "PostgreSQL debug: sending: " << (next.prepared ? next.prepared->name() : next.query)
+                        << std::endl;
+            }
+            if (next.prepared)
+            {
+              next.prepared->null_values = next.null_values;
+              next.prepared->param_values = next.param_values;
+              next.prepared->send();
+            }
+            else if (PQsendQuery(native_handle(), next.query.c_str()) != 1)
+            {
+              throw failure{std::string{PQerrorMessage(native_handle())}};
+            }
+            _sent = true;
+            flush();
+          }
+          catch (const std::exception&)
+          {
+            if (_sent)
+            {
+              // Flushing failed, libpq reports the broken connection as the statement's result
+              _flushing = false;
+              return;
+            }
+            auto failed = std::move(next);
+            _queue.pop_front();
+            failed.complete(nullptr, std::current_exception());
+          }
+        }
+      }
+
+      // Reads the results of the statement that has been sent, completes it and sends the next one
+      size_t read_results(bool block)
+      {
+        size_t completed = 0;
+        while (_sent)
+        {
+          if (not block and PQisBusy(native_handle()) == 1)
+          {
+            break;
+          }
+          // Each statement's results are terminated by a null pointer. If a query string contains several
+          // statements, only the last result is kept (or the first error), like PQexec does.
+          if (PGresult* res = PQgetResult(native_handle()))
+          {
+            if (_result and PQresultStatus(_result) == PGRES_FATAL_ERROR)
+            {
+              PQclear(res);
+            }
+            else
+            {
+              PQclear(_result);
+              _result = res;
+            }
+            continue;
+          }
+          complete_front();
+          ++completed;
+        }
+        return completed;
+      }
+
+      void complete_front()
+      {
+        auto done = std::move(_queue.front());
+        _queue.pop_front();
+        _sent = false;
+
+        auto handle = std::make_shared<detail::statement_handle_t>(*_db._handle);
+        std::exception_ptr error;
+        try
+        {
+          if (not _result)
+          {
+            throw failure{std::string{PQerrorMessage(native_handle())}};
+          }
+          handle->result.query() = done.query;
+          auto res = _result;
+          _result = nullptr;
+          handle->result = res;
+          handle->valid = true;
+        }
+        catch (const std::exception&)
+        {
+          error = std::current_exception();
+        }
+
+        // The next statement is executed while the callback runs
+        send_next();
+        done.complete(handle, error);
+      }
+    };
+
+#if SQLPP_CXX_STD >= 202002L
+    template <typename Statement>
+    void statement_awaitable<Statement>::await_suspend(std::coroutine_handle<> coroutine)
+    {
+      _executor.send(_statement, [this, coroutine](std::exception_ptr error, async_result_t<Statement> result) {
+        _error = error;
+        _result = std::move(result);
+        coroutine.resume();
+      });
+    }
+#endif
+  }  // namespace postgresql
+}  // namespace sqlpp
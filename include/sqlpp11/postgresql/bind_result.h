@@ -39,8 +39,10 @@
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <utility>
 
 #include "detail/prepared_statement_handle.h"
+#include "result_field.h"
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4800)  // int to bool
@@ -58,6 +60,30 @@ namespace sqlpp
     {
     private:
       std::shared_ptr<detail::statement_handle_t> _handle;
+      // The streamed query this result consumes (if any). Prepared statements share their handle with the result, so
+      // the handle outlives a partially read result.
+      size_t _stream_id = 0;
+      // Per column storage for values that need to be converted before they can be handed out
+      std::vector<std::string> _text_buffers;
+      std::vector<std::vector<uint8_t>> _blob_buffers;
+
+      void cancel_stream()
+      {
+        if (_handle and _handle->streaming and _handle->stream_id == _stream_id)
+        {
+          _handle->cancel_streaming();
+        }
+      }
+
+      template <typename Buffer>
+      Buffer& buffer(std::vector<Buffer>& buffers, int index)
+      {
+        if (buffers.size() <= static_cast<size_t>(index))
+        {
+          buffers.resize(static_cast<size_t>(index) + 1);
+        }
+        return buffers[static_cast<size_t>(index)];
+      }
 
       bool next_impl()
       {
@@ -70,7 +96,8 @@ namespace sqlpp
         if (_handle->total_count == 0U)
         {
           _handle->total_count = _handle->result.records_size();
-          if (_handle->total_count == 0U)
+          // In single row and chunked mode, the rows are fetched from the server on demand
+          if (_handle->total_count == 0U and not _handle->fetch_next_result())
             return false;
         }
         else
@@ -80,7 +107,7 @@ namespace sqlpp
           {
             _handle->count++;
           }
-          else
+          else if (not _handle->fetch_next_result())
           {
             return false;
           }
@@ -100,6 +127,10 @@ namespace sqlpp
 
       bind_result_t(const std::shared_ptr<detail::statement_handle_t>& handle) : _handle(handle)
       {
+        if (this->_handle and this->_handle->streaming)
+        {
+          _stream_id = this->_handle->stream_id;
+        }
         if (this->_handle && this->_handle->debug())
         {
           // cerr
@@ -111,14 +142,40 @@ namespace sqlpp
       bind_result_t(const bind_result_t&) = delete;
       bind_result_t(bind_result_t&&) = default;
       bind_result_t& operator=(const bind_result_t&) = delete;
-      bind_result_t& operator=(bind_result_t&&) = default;
-      ~bind_result_t() = default;
+      bind_result_t& operator=(bind_result_t&& rhs)
+      {
+        if (this != &rhs)
+        {
+          cancel_stream();
+          _handle = std::move(rhs._handle);
+          _stream_id = rhs._stream_id;
+          _text_buffers = std::move(rhs._text_buffers);
+          _blob_buffers = std::move(rhs._blob_buffers);
+        }
+        return *this;
+      }
+
+      // Destroying a partially read result cancels the query
+      ~bind_result_t()
+      {
+        cancel_stream();
+      }
 
       bool operator==(const bind_result_t& rhs) const
       {
         return (this->_handle == rhs._handle);
       }
 
+      bool _zero_copy_results() const
+      {
+        return _handle and _handle->connection.config->zero_copy_results;
+      }
+
+      bool _lazy_results() const
+      {
+        return _handle and _handle->connection.config->lazy_results;
+      }
+
       template <typename ResultRow>
       void next(ResultRow& result_row)
       {
@@ -206,6 +263,15 @@ namespace sqlpp
           *value = nullptr;
           *len = 0;
         }
+        else if (_handle->result.is_binary(index))
+        {
+          auto& text = buffer(_text_buffers, index);
+          detail::decode_binary_as_text(text, _handle->result.get_char_ptr_value(_handle->count, index),
+                                        static_cast<size_t>(_handle->result.length(_handle->count, index)),
+                                        _handle->result.type(index));
+          *value = text.data();
+          *len = text.size();
+        }
         else
         {
           *value = _handle->result.get_char_ptr_value(_handle->count, index);
@@ -237,6 +303,13 @@ namespace sqlpp
           return;
         }
 
+        if (_handle->result.is_binary(index))
+        {
+          *value = detail::decode_binary_date(_handle->result.get_char_ptr_value(_handle->count, index),
+                                              _handle->result.type(index));
+          return;
+        }
+
         const auto date_string = _handle->result.get_char_ptr_value(_handle->count, index);
         if (_handle->debug())
         {
@@ -267,6 +340,13 @@ namespace sqlpp
           return;
         }
 
+        if (_handle->result.is_binary(index))
+        {
+          *value = detail::decode_binary_date_time(_handle->result.get_char_ptr_value(_handle->count, index),
+                                                   _handle->result.type(index));
+          return;
+        }
+
         const auto date_string = _handle->result.get_char_ptr_value(_handle->count, index);
         if (_handle->debug())
         {
@@ -297,6 +377,13 @@ namespace sqlpp
           return;
         }
 
+        if (_handle->result.is_binary(index))
+        {
+          *value = detail::decode_binary_time_of_day(_handle->result.get_char_ptr_value(_handle->count, index),
+                                                     _handle->result.type(index));
+          return;
+        }
+
         const auto time_string = _handle->result.get_char_ptr_value(_handle->count, index);
 
         if (_handle->debug())
@@ -325,15 +412,28 @@ namespace sqlpp
           *value = nullptr;
           *len = 0;
         }
-        else
+        else if (_handle->result.is_binary(index))
         {
           *value = _handle->result.get_blob_value(_handle->count, index);
           *len   = static_cast<size_t>(_handle->result.length(_handle->count, index));
         }
+        else
+        {
+          // bytea in text format is hex encoded
+          const auto hex = _handle->result.get_blob_value(_handle->count, index);
+          auto& blob = buffer(_blob_buffers, index);
+          ::sqlpp::detail::hex_assign(blob, hex, static_cast<size_t>(_handle->result.length(_handle->count, index)));
+          *value = blob.empty() ? hex : blob.data();  // non-null even for empty values
+          *len = blob.size();
+        }
       }
 
       int size() const
       {
+        if (_handle->mode != result_mode::buffered)
+        {
+          throw sqlpp::exception{"PostgreSQL error: size() is not available for results in single row or chunked mode"};
+        }
         return _handle->result.records_size();
       }
     };
@@ -32,7 +32,7 @@
 
 #include <sqlpp11/compat/make_unique.h>
 #include <sqlpp11/connection.h>
-#include <sqlpp11/detail/float_safe_ostringstream.h>
+#include <sqlpp11/detail/serialization_buffer.h>
 #include <sqlpp11/postgresql/bind_result.h>
 #include <sqlpp11/postgresql/result_field.h>
 #include <sqlpp11/postgresql/connection_config.h>
@@ -42,6 +42,7 @@
 #include <sqlpp11/postgresql/detail/connection_handle.h>
 #include <sqlpp11/postgresql/detail/prepared_statement_handle.h>
 #include <sqlpp11/serialize.h>
+#include <sqlpp11/static_sql.h>
 #include <sqlpp11/transaction.h>
 
 #ifdef SQLPP_DYNAMIC_LOADING
@@ -73,41 +74,47 @@ namespace sqlpp
         return sqlpp::compat::make_unique<detail::prepared_statement_handle_t>(*handle, stmt, param_count);
       }
 
-      inline void execute_prepared_statement(std::unique_ptr<connection_handle>& handle, std::shared_ptr<detail::prepared_statement_handle_t>& prepared)
+      inline void execute_prepared_statement(std::unique_ptr<connection_handle>& handle,
+                                             std::shared_ptr<detail::prepared_statement_handle_t>& prepared,
+                                             result_mode mode = result_mode::buffered,
+                                             int chunk_size = 0)
       {
         if (handle->config->debug)
         {
           std::cerr << "PostgreSQL debug: executing: " << prepared->name() << std::endl;
         }
-        prepared->execute();
+        prepared->execute(mode, chunk_size);
       }
     }
 
     // Forward declaration
     class connection_base;
+    class pipeline;
+    class async_executor;
+    template <typename Table, typename... Columns>
+    class copy_in_t;
+    class copy_out_result_t;
 
     // Context
     struct context_t
     {
-      context_t(const connection_base& db) : _db(db)
-      {
-      }
+      context_t(const connection_base& db);
       context_t(connection_base&&) = delete;
 
       template <typename T>
-      std::ostream& operator<<(T t)
+      sqlpp::detail::serialization_buffer& operator<<(T t)
       {
         return _os << t;
       }
 
-      std::ostream& operator<<(bool t)
+      sqlpp::detail::serialization_buffer& operator<<(bool t)
       {
         return _os << (t ? "TRUE" : "FALSE");
       }
 
       std::string escape(const std::string& arg) const;
 
-      std::string str() const
+      const std::string& str() const
       {
         return _os.str();
       }
@@ -123,15 +130,31 @@ namespace sqlpp
       }
 
       const connection_base& _db;
-      sqlpp::detail::float_safe_ostringstream _os;
+      sqlpp::detail::serialization_buffer _os;
       size_t _count{1};
     };
 
+    // Parameters are numbered, see static_sql.h
+    std::integral_constant<char, '$'> get_parameter_prefix(const context_t&);
+
+    std::true_type are_parameters_numbered(const context_t&);
+
     // Base connection class
     class connection_base : public sqlpp::connection
     {
     private:
+      friend class pipeline;
+      friend class async_executor;
+      template <typename Table, typename... Columns>
+      friend class copy_in_t;
+      friend class copy_out_result_t;
+      friend struct context_t;
+      // Reused by context_t for serializing statements
+      mutable std::string _serialization_buffer;
+
       bool _transaction_active{false};
+      result_mode _result_mode{result_mode::buffered};
+      int _chunk_size{0};
 
       void validate_connection_handle() const
       {
@@ -140,10 +163,51 @@ namespace sqlpp
         }
       }
 
+      // Statements cannot be sent while the rows of a result are still being streamed from the server
+      void validate_connection_idle() const
+      {
+        validate_connection_handle();
+        if (_handle->streaming)
+        {
+          throw sqlpp::exception{
+              "PostgreSQL error: connection is busy streaming a result, read it completely or destroy it first"};
+        }
+        if (_handle->pipeline)
+        {
+          throw sqlpp::exception{"PostgreSQL error: connection is in pipeline mode, destroy the pipeline first"};
+        }
+        if (_handle->copying)
+        {
+          throw sqlpp::exception{"PostgreSQL error: connection is busy copying data, finish or destroy the copy first"};
+        }
+        if (_handle->async)
+        {
+          throw sqlpp::exception{
+              "PostgreSQL error: connection is used for asynchronous statements, destroy the async executor first"};
+        }
+      }
+
       // direct execution
       bind_result_t select_impl(const std::string& stmt)
       {
-        return execute(stmt);
+        if (_result_mode == result_mode::buffered)
+        {
+          return execute(stmt);
+        }
+        validate_connection_idle();
+        if (_handle->config->debug)
+        {
+          std::cerr << "PostgreSQL debug: executing (streamed): " << stmt << std::endl;
+        }
+
+        auto result = std::make_shared<detail::statement_handle_t>(*_handle);
+        if (PQsendQuery(native_handle(), stmt.c_str()) != 1)
+        {
+          throw failure{std::string{PQerrorMessage(native_handle())}};
+        }
+        result->start_streaming(_result_mode, _chunk_size);
+        result->valid = true;
+        return result;
       }
 
       size_t insert_impl(const std::string& stmt)
@@ -164,41 +228,74 @@ namespace sqlpp
       // prepared execution
       prepared_statement_t prepare_impl(const std::string& stmt, const size_t& param_count)
       {
-        validate_connection_handle();
-        return {prepare_statement(_handle, stmt, param_count)};
+        validate_connection_idle();
+        if (auto cached = _handle->statement_cache.get(stmt))
+        {
+          return {std::move(cached)};
+        }
+        return {_handle->statement_cache.put(stmt, prepare_statement(_handle, stmt, param_count))};
+      }
+
+      // Prepares a directly executed statement with its literal values bound as parameters, if configured (returns a
+      // statement without handle otherwise)
+      template <typename Statement>
+      prepared_statement_t prepare_literals(const Statement& s)
+      {
+        return prepare_literals(s, has_parameterizable_values_t<context_t, Statement>{});
+      }
+
+      template <typename Statement>
+      prepared_statement_t prepare_literals(const Statement& s, const std::true_type&)
+      {
+        if (not _handle->config->parameterize_literals)
+        {
+          return {};
+        }
+        context_t ctx{*this};
+        const auto param_count = serialize_parameterized(s, ctx);
+        auto prepared = prepare_impl(ctx.str(), param_count);
+        sqlpp::static_value_binder<prepared_statement_t> binder{prepared, 0};
+        sql_shape_t<context_t, Statement>::visit_values(s, binder);
+        return prepared;
+      }
+
+      template <typename Statement>
+      prepared_statement_t prepare_literals(const Statement& /*unused*/, const std::false_type&)
+      {
+        return {};
       }
 
       bind_result_t run_prepared_select_impl(prepared_statement_t& prep)
       {
-        validate_connection_handle();
-        execute_prepared_statement(_handle, prep._handle);
+        validate_connection_idle();
+        execute_prepared_statement(_handle, prep._handle, _result_mode, _chunk_size);
         return {prep._handle};
       }
 
       size_t run_prepared_execute_impl(prepared_statement_t& prep)
       {
-        validate_connection_handle();
+        validate_connection_idle();
         execute_prepared_statement(_handle, prep._handle);
         return static_cast<size_t>(prep._handle->result.affected_rows());
       }
 
       size_t run_prepared_insert_impl(prepared_statement_t& prep)
       {
-        validate_connection_handle();
+        validate_connection_idle();
         execute_prepared_statement(_handle, prep._handle);
         return static_cast<size_t>(prep._handle->result.affected_rows());
       }
 
       size_t run_prepared_update_impl(prepared_statement_t& prep)
       {
-        validate_connection_handle();
+        validate_connection_idle();
         execute_prepared_statement(_handle, prep._handle);
         return static_cast<size_t>(prep._handle->result.affected_rows());
       }
 
       size_t run_prepared_remove_impl(prepared_statement_t& prep)
       {
-        validate_connection_handle();
+        validate_connection_idle();
         execute_prepared_statement(_handle, prep._handle);
         return static_cast<size_t>(prep._handle->result.affected_rows());
       }
@@ -214,6 +311,8 @@ namespace sqlpp
       using _context_t = context_t;
       using _serializer_context_t = _context_t;
       using _interpreter_context_t = _context_t;
+      // Result fields can be bound on first access, see connection_config::lazy_results
+      using _lazy_results_t = std::true_type;
 
       struct _tags
       {
@@ -236,9 +335,13 @@ namespace sqlpp
       template <typename Select>
       bind_result_t select(const Select& s)
       {
+        auto prepared = prepare_literals(s);
+        if (prepared._handle)
+        {
+          return run_prepared_select_impl(prepared);
+        }
         _context_t ctx{*this};
-        serialize(s, ctx);
-        return select_impl(ctx.str());
+        return select_impl(serialize_statement(s, ctx));
       }
 
       // Prepared select
@@ -246,8 +349,8 @@ namespace sqlpp
       _prepared_statement_t prepare_select(Select& s)
       {
         _context_t ctx{*this};
-        serialize(s, ctx);
-        return prepare_impl(ctx.str(), ctx.count() - 1);
+        const auto& query = serialize_statement(s, ctx);
+        return prepare_impl(query, ctx.count() - 1);
       }
 
       template <typename PreparedSelect>
@@ -261,17 +364,21 @@ namespace sqlpp
       template <typename Insert>
       size_t insert(const Insert& i)
       {
+        auto prepared = prepare_literals(i);
+        if (prepared._handle)
+        {
+          return run_prepared_insert_impl(prepared);
+        }
         _context_t ctx{*this};
-        serialize(i, ctx);
-        return insert_impl(ctx.str());
+        return insert_impl(serialize_statement(i, ctx));
       }
 
       template <typename Insert>
       prepared_statement_t prepare_insert(Insert& i)
       {
         _context_t ctx{*this};
-        serialize(i, ctx);
-        return prepare_impl(ctx.str(), ctx.count() - 1);
+        const auto& query = serialize_statement(i, ctx);
+        return prepare_impl(query, ctx.count() - 1);
       }
 
       template <typename PreparedInsert>
@@ -285,17 +392,21 @@ namespace sqlpp
       template <typename Update>
       size_t update(const Update& u)
       {
+        auto prepared = prepare_literals(u);
+        if (prepared._handle)
+        {
+          return run_prepared_update_impl(prepared);
+        }
         _context_t ctx{*this};
-        serialize(u, ctx);
-        return update_impl(ctx.str());
+        return update_impl(serialize_statement(u, ctx));
       }
 
       template <typename Update>
       prepared_statement_t prepare_update(Update& u)
       {
         _context_t ctx{*this};
-        serialize(u, ctx);
-        return prepare_impl(ctx.str(), ctx.count() - 1);
+        const auto& query = serialize_statement(u, ctx);
+        return prepare_impl(query, ctx.count() - 1);
       }
 
       template <typename PreparedUpdate>
@@ -309,17 +420,21 @@ namespace sqlpp
       template <typename Remove>
       size_t remove(const Remove& r)
       {
+        auto prepared = prepare_literals(r);
+        if (prepared._handle)
+        {
+          return run_prepared_remove_impl(prepared);
+        }
         _context_t ctx{*this};
-        serialize(r, ctx);
-        return remove_impl(ctx.str());
+        return remove_impl(serialize_statement(r, ctx));
       }
 
       template <typename Remove>
       prepared_statement_t prepare_remove(Remove& r)
       {
         _context_t ctx{*this};
-        serialize(r, ctx);
-        return prepare_impl(ctx.str(), ctx.count() - 1);
+        const auto& query = serialize_statement(r, ctx);
+        return prepare_impl(query, ctx.count() - 1);
       }
 
       template <typename PreparedRemove>
@@ -334,7 +449,7 @@ namespace sqlpp
       //! align with other connectors.
       std::shared_ptr<detail::statement_handle_t> execute(const std::string& stmt)
       {
-        validate_connection_handle();
+        validate_connection_idle();
         if (_handle->config->debug)
         {
           std::cerr << "PostgreSQL debug: executing: " << stmt << std::endl;
@@ -356,8 +471,7 @@ namespace sqlpp
         static_assert(not sqlpp::is_select_t<Execute>::value, "argument must not be a select statement - use operator() instead");
 
         _context_t context{*this};
-        serialize(x, context);
-        return static_cast<size_t>(execute(context.str())->result.affected_rows());
+        return static_cast<size_t>(execute(serialize_statement(x, context))->result.affected_rows());
       }
 
       template <
@@ -401,6 +515,13 @@ namespace sqlpp
         return t._run(*this);
       }
 
+      // Statements that change when they are run, e.g. prepared batch inserts
+      template <typename T>
+      auto _run(T& t, sqlpp::consistent_t) -> decltype(t._run(*this))
+      {
+        return t._run(*this);
+      }
+
       template <typename Check, typename T>
       auto _run(const T& t, Check) -> Check;
 
@@ -410,6 +531,12 @@ namespace sqlpp
         return _run(t, sqlpp::run_check_t<_serializer_context_t, T>{});
       }
 
+      template <typename T>
+      auto operator()(T& t) -> decltype(this->_run(t, sqlpp::run_check_t<_serializer_context_t, T>{}))
+      {
+        return _run(t, sqlpp::run_check_t<_serializer_context_t, T>{});
+      }
+
       //! call prepare on the argument
       template <typename T>
       auto _prepare(const T& t, ::sqlpp::consistent_t) -> decltype(t._prepare(*this))
@@ -426,6 +553,20 @@ namespace sqlpp
         return _prepare(t, sqlpp::prepare_check_t<_serializer_context_t, T>{});
       }
 
+      //! choose how the rows of subsequent selects are transferred from the server, see result_mode.
+      //! In single row or chunked mode, no other statement can be executed on this connection until the result has
+      //! been read completely or destroyed.
+      void set_result_mode(result_mode mode, int chunk_size = 1000)
+      {
+        _result_mode = mode;
+        _chunk_size = chunk_size;
+      }
+
+      result_mode get_result_mode() const
+      {
+        return _result_mode;
+      }
+
       //! set the default transaction isolation level to use for new transactions
       void set_default_isolation_level(isolation_level level)
       {
@@ -597,6 +738,12 @@ namespace sqlpp
         return std::stoul(in);
       }
 
+      //! hits and misses of prepare() in the statement cache, see connection_config::statement_cache_size
+      sqlpp::statement_cache_stats get_statement_cache_stats() const
+      {
+        return _handle->statement_cache.stats();
+      }
+
       ::PGconn* native_handle() const
       {
         return _handle->native_handle();
@@ -612,7 +759,11 @@ namespace sqlpp
       }
     };
 
-    // Method definition moved outside of class because it needs connection_base
+    // Method definitions moved outside of class because they need connection_base
+    inline context_t::context_t(const connection_base& db) : _db(db), _os(db._serialization_buffer)
+    {
+    }
+
     inline std::string context_t::escape(const std::string& arg) const
     {
       return _db.escape(arg);
@@ -71,6 +71,16 @@ namespace sqlpp
       std::string service;
       // bool auto_reconnect {true};
       bool debug{false};
+      // Transfer parameters and results of prepared statements in binary format where the types allow it
+      bool binary_format{false};
+      // Number of prepared statements kept per connection for reuse by prepare(), 0 disables the cache
+      size_t statement_cache_size{0};
+      // Text and blob result fields point into the result instead of copying it (valid until the next row)
+      bool zero_copy_results{false};
+      // Result fields are parsed from the current row when they are first accessed instead of with the row
+      bool lazy_results{false};
+      // Directly executed statements bind their literal values as parameters and are prepared via the statement cache
+      bool parameterize_literals{false};
 
       bool operator==(const connection_config& other)
       {
@@ -82,7 +92,10 @@ namespace sqlpp
                 other.keepalives_count == keepalives_count && other.sslmode == sslmode &&
                 other.sslcompression == sslcompression && other.sslcert == sslcert && other.sslkey == sslkey &&
                 other.sslrootcert == sslrootcert && other.sslcrl == sslcrl && other.requirepeer == requirepeer &&
-                other.krbsrvname == krbsrvname && other.service == service && other.debug == debug);
+                other.krbsrvname == krbsrvname && other.service == service && other.debug == debug &&
+                other.binary_format == binary_format && other.statement_cache_size == statement_cache_size &&
+                other.zero_copy_results == zero_copy_results && other.lazy_results == lazy_results &&
+                other.parameterize_literals == parameterize_literals);
       }
       bool operator!=(const connection_config& other)
       {
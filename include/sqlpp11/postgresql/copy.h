@@ -0,0 +1,1072 @@
+#pragma once
+
+/**
+ * Copyright © 2014-2015, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <sqlpp11/insert_value.h>
+#include <sqlpp11/interpret_tuple.h>
+#include <sqlpp11/result.h>
+#include <sqlpp11/detail/parse_date_time.h>
+#include <sqlpp11/detail/parse_number.h>
+#include <sqlpp11/simple_column.h>
+#include <sqlpp11/type_traits.h>
+#include <sqlpp11/postgresql/connection.h>
+#include <sqlpp11/postgresql/result_field.h>
+#include <sqlpp11/postgresql/detail/binary_format.h>
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+
+    enum class copy_format
+    {
+      text,
+      binary  // requires the columns to have types with a binary representation known to the connector
+    };
+
+    struct copy_options
+    {
+      copy_format format = copy_format::text;
+      // rows are sent to the server whenever this many bytes have been buffered
+      size_t buffer_size = 64 * 1024;
+    };
+
+    namespace detail
+    {
+      // Values in COPY text format (see https://www.postgresql.org/docs/current/sql-copy.html)
+      inline void append_copy_text(std::string& out, const std::string& value, Oid)
+      {
+        for (const auto c : value)
+        {
+          switch (c)
+          {
+            case '\\':
+              out.append("\\\\");
+              break;
+            case '\t':
+              out.append("\\t");
+              break;
+            case '\n':
+              out.append("\\n");
+              break;
+            case '\r':
+              out.append("\\r");
+              break;
+            default:
+              out.push_back(c);
+          }
+        }
+      }
+
+      inline void append_copy_text(std::string& out, int64_t value, Oid)
+      {
+        out.append(std::to_string(value));
+      }
+
+      inline void append_copy_text(std::string& out, uint64_t value, Oid)
+      {
+        out.append(std::to_string(value));
+      }
+
+      inline void append_copy_text(std::string& out, double value, Oid)
+      {
+        if (std::isnan(value))
+        {
+          out.append("NaN");
+        }
+        else if (std::isinf(value))
+        {
+          out.append(value > 0 ? "Infinity" : "-Infinity");
+        }
+        else
+        {
+          sqlpp::detail::float_safe_ostringstream os;
+          os << value;
+          out.append(os.str());
+        }
+      }
+
+      inline void append_copy_text(std::string& out, bool value, Oid)
+      {
+        out.push_back(value ? 't' : 'f');
+      }
+
+      inline void append_copy_text(std::string& out, const ::sqlpp::chrono::day_point& value, Oid)
+      {
+        std::ostringstream os;
+        os << ::date::year_month_day{value};
+        out.append(os.str());
+      }
+
+      // Timezone handling - always treat the local value as UTC.
+      inline void append_copy_text(std::string& out, const ::sqlpp::chrono::microsecond_point& value, Oid)
+      {
+        const auto dp = ::sqlpp::chrono::floor<::date::days>(value);
+        std::ostringstream os;
+        os << ::date::year_month_day{dp} << ' '
+           << ::date::make_time(::sqlpp::chrono::floor<::std::chrono::microseconds>(value - dp)) << "+00";
+        out.append(os.str());
+      }
+
+      inline void append_copy_text(std::string& out, const std::chrono::microseconds& value, Oid)
+      {
+        std::ostringstream os;
+        os << ::date::make_time(value) << "+00";
+        out.append(os.str());
+      }
+
+      inline void append_copy_text(std::string& out, const std::vector<uint8_t>& value, Oid)
+      {
+        constexpr char hex_chars[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+        out.append("\\\\x");  // escaped backslash
+        for (const auto c : value)
+        {
+          out.push_back(hex_chars[c >> 4]);
+          out.push_back(hex_chars[c & 0x0F]);
+        }
+      }
+
+      [[noreturn]] inline void throw_copy_type_mismatch(const char* value_type, Oid type)
+      {
+        throw sqlpp::exception{std::string{"PostgreSQL error: cannot write "} + value_type +
+                               " value to column of type oid " + std::to_string(type) + " in binary COPY format"};
+      }
+
+      // Values in COPY binary format, which have to match the column type exactly
+      inline void append_copy_binary(std::string& out, int64_t value, Oid type)
+      {
+        switch (type)
+        {
+          case int8_oid:
+            append_big_endian(out, static_cast<uint64_t>(value), 8);
+            return;
+          case int4_oid:
+            if (value < std::numeric_limits<int32_t>::min() or value > std::numeric_limits<int32_t>::max())
+              throw sqlpp::exception{"PostgreSQL error: value " + std::to_string(value) + " out of range for integer"};
+            append_big_endian(out, static_cast<uint64_t>(value), 4);
+            return;
+          case int2_oid:
+            if (value < std::numeric_limits<int16_t>::min() or value > std::numeric_limits<int16_t>::max())
+              throw sqlpp::exception{"PostgreSQL error: value " + std::to_string(value) + " out of range for smallint"};
+            append_big_endian(out, static_cast<uint64_t>(value), 2);
+            return;
+          default:
+            throw_copy_type_mismatch("integral", type);
+        }
+      }
+
+      inline void append_copy_binary(std::string& out, uint64_t value, Oid type)
+      {
+        if (value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+          throw sqlpp::exception{"PostgreSQL error: value " + std::to_string(value) + " out of range for bigint"};
+        append_copy_binary(out, static_cast<int64_t>(value), type);
+      }
+
+      inline void append_copy_binary(std::string& out, double value, Oid type)
+      {
+        switch (type)
+        {
+          case float8_oid:
+          {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            append_big_endian(out, bits, 8);
+            return;
+          }
+          case float4_oid:
+          {
+            const auto narrowed = static_cast<float>(value);
+            uint32_t bits;
+            std::memcpy(&bits, &narrowed, sizeof(bits));
+            append_big_endian(out, bits, 4);
+            return;
+          }
+          default:
+            throw_copy_type_mismatch("floating point", type);
+        }
+      }
+
+      inline void append_copy_binary(std::string& out, bool value, Oid type)
+      {
+        if (type != bool_oid)
+          throw_copy_type_mismatch("boolean", type);
+        out.push_back(value ? 1 : 0);
+      }
+
+      inline void append_copy_binary(std::string& out, const std::string& value, Oid type)
+      {
+        if (not is_text_type(type))
+          throw_copy_type_mismatch("text", type);
+        out.append(value);
+      }
+
+      inline void append_copy_binary(std::string& out, const ::sqlpp::chrono::microsecond_point& value, Oid type)
+      {
+        const auto us = ::sqlpp::chrono::floor<::std::chrono::microseconds>(value).time_since_epoch().count();
+        switch (type)
+        {
+          case timestamp_oid:
+          case timestamptz_oid:
+            append_big_endian(out, static_cast<uint64_t>(us - postgres_epoch_days * microseconds_per_day), 8);
+            return;
+          case date_oid:
+            append_big_endian(
+                out,
+                static_cast<uint64_t>(
+                    ::sqlpp::chrono::floor<::date::days>(value).time_since_epoch().count() - postgres_epoch_days),
+                4);
+            return;
+          default:
+            throw_copy_type_mismatch("time point", type);
+        }
+      }
+
+      inline void append_copy_binary(std::string& out, const ::sqlpp::chrono::day_point& value, Oid type)
+      {
+        append_copy_binary(out, ::sqlpp::chrono::microsecond_point{value}, type);
+      }
+
+      inline void append_copy_binary(std::string& out, const std::chrono::microseconds& value, Oid type)
+      {
+        switch (type)
+        {
+          case time_oid:
+            append_big_endian(out, static_cast<uint64_t>(value.count()), 8);
+            return;
+          case timetz_oid:
+            append_big_endian(out, static_cast<uint64_t>(value.count()), 8);
+            append_big_endian(out, 0, 4);  // UTC
+            return;
+          default:
+            throw_copy_type_mismatch("time of day", type);
+        }
+      }
+
+      inline void append_copy_binary(std::string& out, const std::vector<uint8_t>& value, Oid type)
+      {
+        if (type != bytea_oid)
+          throw_copy_type_mismatch("blob", type);
+        out.append(value.begin(), value.end());
+      }
+    }  // namespace detail
+
+    // Bulk loads rows into a table with COPY ... FROM STDIN, see copy_into()
+    template <typename Table, typename... Columns>
+    class copy_in_t
+    {
+    public:
+      using _value_tuple_t = std::tuple<insert_value_t<Columns>...>;
+
+      copy_in_t(connection_base& db, const Table& table, const copy_options& options, const Columns&... columns)
+          : _db(&db), _options(options)
+      {
+        db.validate_connection_idle();
+        _types.assign(sizeof...(Columns), 0);
+        if (_options.format == copy_format::binary)
+        {
+          read_column_types(table, columns...);
+        }
+
+        context_t context{db};
+        context << "COPY ";
+        serialize(table, context);
+        context << " (";
+        interpret_tuple(std::make_tuple(simple_column(columns)...), ",", context);
+        context << ") FROM STDIN";
+        if (_options.format == copy_format::binary)
+        {
+          context << " WITH (FORMAT binary)";
+        }
+        if (db._handle->config->debug)
+        {
+          std::cerr << "PostgreSQL debug: executing: " << context.str() << std::endl;
+        }
+        Result result;
+        result = PQexec(db.native_handle(), context.str().c_str());
+        if (result.status() != PGRES_COPY_IN)
+        {
+          throw failure{"PostgreSQL error: COPY did not start, got status " +
+                        std::string{PQresStatus(result.status())}};
+        }
+        db._handle->copying = true;
+
+        _buffer.reserve(_options.buffer_size + 1024);
+        if (_options.format == copy_format::binary)
+        {
+          // Signature, flags, header extension length
+          _buffer.append("PGCOPY\n\377\r\n\0", 11);
+          detail::append_big_endian(_buffer, 0, 4);
+          detail::append_big_endian(_buffer, 0, 4);
+        }
+      }
+
+      copy_in_t(const copy_in_t&) = delete;
+      copy_in_t(copy_in_t&& rhs)
+          : _db(rhs._db), _options(rhs._options), _types(std::move(rhs._types)), _buffer(std::move(rhs._buffer))
+      {
+        rhs._db = nullptr;
+      }
+      copy_in_t& operator=(const copy_in_t&) = delete;
+      copy_in_t& operator=(copy_in_t&&) = delete;
+
+      // Aborts the COPY if it has not been finished, none of the rows are stored then
+      ~copy_in_t()
+      {
+        if (_db)
+        {
+          PQputCopyEnd(_db->native_handle(), "aborted by client");
+          try
+          {
+            end();
+          }
+          catch (const sqlpp::exception&)
+          {
+            // the server reports the abort as an error
+          }
+        }
+      }
+
+      template <typename... Assignments>
+      void add(Assignments... assignments)
+      {
+        static_assert(logic::all_t<is_assignment_t<Assignments>::value...>::value,
+                      "add() arguments have to be assignments");
+        using _arg_value_tuple = std::tuple<insert_value_t<lhs_t<Assignments>>...>;
+        using _args_correct = std::is_same<_arg_value_tuple, _value_tuple_t>;
+        static_assert(_args_correct::value, "add() arguments do not match columns() arguments");
+
+        using ok = logic::all_t<logic::all_t<is_assignment_t<Assignments>::value...>::value, _args_correct::value>;
+
+        _add_impl(ok(), assignments...);  // dispatch to prevent compile messages after the static_assert
+      }
+
+      // Sends the remaining rows and ends the COPY, returns the number of rows copied
+      size_t finish()
+      {
+        validate_active();
+        if (_options.format == copy_format::binary)
+        {
+          detail::append_big_endian(_buffer, static_cast<uint64_t>(-1), 2);  // file trailer
+        }
+        send_buffer();
+        if (PQputCopyEnd(_db->native_handle(), nullptr) != 1)
+        {
+          throw failure{std::string{PQerrorMessage(_db->native_handle())}};
+        }
+        return end();
+      }
+
+    private:
+      connection_base* _db;
+      copy_options _options;
+      std::vector<Oid> _types;
+      std::string _buffer;
+
+      void read_column_types(const Table& table, const Columns&... columns)
+      {
+        context_t context{*_db};
+        context << "SELECT ";
+        interpret_tuple(std::make_tuple(simple_column(columns)...), ",", context);
+        context << " FROM ";
+        serialize(table, context);
+        context << " LIMIT 0";
+        const auto statement = _db->execute(context.str());
+        for (size_t i = 0; i < _types.size(); ++i)
+        {
+          _types[i] = statement->result.type(static_cast<int>(i));
+          if (not detail::is_binary_decodable(_types[i]))
+          {
+            throw sqlpp::exception{"PostgreSQL error: column type oid " + std::to_string(_types[i]) +
+                                   " is not supported in binary COPY format, use text format instead"};
+          }
+        }
+      }
+
+      void validate_active() const
+      {
+        if (not _db)
+        {
+          throw sqlpp::exception{"PostgreSQL error: COPY has already been finished"};
+        }
+      }
+
+      template <typename... Assignments>
+      void _add_impl(const std::true_type&, Assignments... assignments)
+      {
+        validate_active();
+        // A field that cannot be written drops the whole row, the rows before it are still sent
+        const auto row_start = _buffer.size();
+        try
+        {
+          if (_options.format == copy_format::binary)
+          {
+            detail::append_big_endian(_buffer, sizeof...(Assignments), 2);
+          }
+          size_t index = 0;
+          using swallow = int[];
+          (void)swallow{0, (append_field(index++, insert_value_t<lhs_t<Assignments>>{assignments._rhs}), 0)...};
+          if (_options.format == copy_format::text)
+          {
+            _buffer.back() = '\n';  // replaces the last field separator
+          }
+        }
+        catch (...)
+        {
+          _buffer.resize(row_start);
+          throw;
+        }
+        if (_buffer.size() >= _options.buffer_size)
+        {
+          send_buffer();
+        }
+      }
+
+      template <typename... Assignments>
+      void _add_impl(const std::false_type&, Assignments... assignments);
+
+      template <typename Column>
+      void append_field(size_t index, const insert_value_t<Column>& value)
+      {
+        if (value._is_default)
+        {
+          throw sqlpp::exception{"PostgreSQL error: default values are not supported by COPY"};
+        }
+        if (_options.format == copy_format::text)
+        {
+          if (value._is_null)
+            _buffer.append("\\N");
+          else
+            detail::append_copy_text(_buffer, value._value._t, _types[index]);
+          _buffer.push_back('\t');
+        }
+        else if (value._is_null)
+        {
+          detail::append_big_endian(_buffer, static_cast<uint64_t>(-1), 4);
+        }
+        else
+        {
+          // The length is filled in once the value has been written
+          const auto length_position = _buffer.size();
+          _buffer.append(4, '\0');
+          detail::append_copy_binary(_buffer, value._value._t, _types[index]);
+          const auto length = static_cast<uint32_t>(_buffer.size() - length_position - 4);
+          for (size_t i = 0; i < 4; ++i)
+          {
+            _buffer[length_position + i] = static_cast<char>((length >> (8 * (3 - i))) & 0xFF);
+          }
+        }
+      }
+
+      void send_buffer()
+      {
+        if (not _buffer.empty() and
+            PQputCopyData(_db->native_handle(), _buffer.data(), static_cast<int>(_buffer.size())) != 1)
+        {
+          throw failure{std::string{PQerrorMessage(_db->native_handle())}};
+        }
+        _buffer.clear();
+      }
+
+      // Reads the outcome of the COPY and makes the connection usable again
+      size_t end()
+      {
+        auto db = _db;
+        _db = nullptr;
+        db->_handle->copying = false;
+
+        PGresult* res = PQgetResult(db->native_handle());
+        while (PGresult* trailing = res ? PQgetResult(db->native_handle()) : nullptr)
+        {
+          PQclear(trailing);
+        }
+        Result result;
+        result = res;
+        return static_cast<size_t>(result.affected_rows());
+      }
+    };
+
+    template <typename Table>
+    struct copy_into_t
+    {
+      connection_base& _db;
+      Table _table;
+      copy_options _options;
+
+      // Starts the COPY, rows are then added like with insert_into(table).columns(...)
+      template <typename... Columns>
+      copy_in_t<Table, Columns...> columns(Columns... columns) const
+      {
+        static_assert(sizeof...(Columns) > 0, "at least one column required in columns()");
+        static_assert(logic::all_t<is_column_t<Columns>::value...>::value,
+                      "arguments for columns() must be table columns");
+        static_assert(logic::all_t<std::is_same<typename Columns::_table, Table>::value...>::value,
+                      "columns() arguments must be columns of the table passed to copy_into()");
+        return {_db, _table, _options, columns...};
+      }
+    };
+
+    //   auto copy = copy_into(db, tab).columns(tab.alpha, tab.gamma);
+    //   copy.add(tab.alpha = 17, tab.gamma = "seventeen");
+    //   const auto row_count = copy.finish();
+    template <typename Table>
+    copy_into_t<Table> copy_into(connection_base& db, Table table, const copy_options& options = {})
+    {
+      static_assert(is_raw_table_t<Table>::value, "copy_into() requires a table");
+      return {db, table, options};
+    }
+
+    namespace detail
+    {
+      // State of a COPY ... TO STDOUT, see copy_out()
+      struct copy_out_handle_t
+      {
+        struct field_t
+        {
+          const char* data;
+          size_t length;
+          bool is_null;
+        };
+
+        connection_handle& connection;
+        std::vector<Oid> types;
+        bool binary;
+        bool active = false;  // rows are still being received
+        bool header_read = false;
+        char* message = nullptr;  // the current row as received by PQgetCopyData
+        std::vector<field_t> fields;
+        std::vector<std::string> text_fields;  // unescaped values (text format only)
+
+        copy_out_handle_t(connection_handle& _connection, std::vector<Oid> _types, bool _binary)
+            : connection(_connection), types(std::move(_types)), binary(_binary)
+        {
+        }
+
+        copy_out_handle_t(const copy_out_handle_t&) = delete;
+        copy_out_handle_t(copy_out_handle_t&&) = delete;
+        copy_out_handle_t& operator=(const copy_out_handle_t&) = delete;
+        copy_out_handle_t& operator=(copy_out_handle_t&&) = delete;
+
+        ~copy_out_handle_t()
+        {
+          release_message();
+          if (active)
+          {
+            cancel();
+          }
+        }
+
+        void start()
+        {
+          active = true;
+          connection.copying = true;
+        }
+
+        // Reads the next row, returns false once all rows have been read
+        bool next_row()
+        {
+          release_message();
+          while (active)
+          {
+            const auto length = PQgetCopyData(connection.native_handle(), &message, 0);
+            if (length == -1)
+            {
+              finish();
+              return false;
+            }
+            if (length < 0)
+            {
+              active = false;
+              connection.copying = false;
+              throw failure{std::string{PQerrorMessage(connection.native_handle())}};
+            }
+            if (binary ? split_binary_row(message, static_cast<size_t>(length))
+                       : split_text_row(message, static_cast<size_t>(length)))
+            {
+              return true;
+            }
+            release_message();  // header or trailer only
+          }
+          return false;
+        }
+
+        const field_t& field(size_t index) const
+        {
+          if (index >= fields.size())
+          {
+            throw sqlpp::exception{"PostgreSQL error: COPY row has fewer fields than expected"};
+          }
+          return fields[index];
+        }
+
+        // True if the field has to be decoded from its binary representation
+        bool is_binary(size_t index) const
+        {
+          return binary and not is_text_type(types[index]);
+        }
+
+      private:
+        void release_message()
+        {
+          if (message)
+          {
+            PQfreemem(message);
+            message = nullptr;
+          }
+        }
+
+        // Reads the outcome of the COPY, throws if it failed
+        void finish()
+        {
+          active = false;
+          connection.copying = false;
+          PGresult* res = PQgetResult(connection.native_handle());
+          while (PGresult* trailing = res ? PQgetResult(connection.native_handle()) : nullptr)
+          {
+            PQclear(trailing);
+          }
+          Result result;
+          result = res;
+        }
+
+        // Stops a COPY that has not been read completely
+        void cancel()
+        {
+          if (PGcancel* cancel = PQgetCancel(connection.native_handle()))
+          {
+            char error[256];
+            PQcancel(cancel, error, sizeof(error));
+            PQfreeCancel(cancel);
+          }
+          while (PQgetCopyData(connection.native_handle(), &message, 0) >= 0)
+          {
+            release_message();
+          }
+          try
+          {
+            finish();
+          }
+          catch (const sqlpp::exception&)
+          {
+            // the server reports the cancellation as an error
+          }
+        }
+
+        bool split_binary_row(const char* data, size_t length)
+        {
+          const char* const end = data + length;
+          auto require = [&](size_t size) {
+            if (static_cast<size_t>(end - data) < size)
+            {
+              throw failure{"PostgreSQL error: truncated row in binary COPY data"};
+            }
+          };
+          if (not header_read)
+          {
+            // Signature, flags, header extension length and header extension
+            require(19);
+            if (std::memcmp(data, "PGCOPY\n\377\r\n\0", 11) != 0)
+            {
+              throw failure{"PostgreSQL error: invalid binary COPY signature"};
+            }
+            const auto extension_length = static_cast<size_t>(read_big_endian(data + 15, 4));
+            require(19 + extension_length);
+            data += 19 + extension_length;
+            header_read = true;
+            if (data == end)
+            {
+              return false;
+            }
+          }
+
+          require(2);
+          const auto field_count = static_cast<int16_t>(read_big_endian(data, 2));
+          data += 2;
+          if (field_count < 0)
+          {
+            return false;  // trailer
+          }
+          fields.resize(static_cast<size_t>(field_count));
+          for (auto& field : fields)
+          {
+            require(4);
+            const auto field_length = static_cast<int32_t>(read_big_endian(data, 4));
+            data += 4;
+            field.is_null = field_length < 0;
+            field.data = data;
+            field.length = field.is_null ? 0 : static_cast<size_t>(field_length);
+            require(field.length);
+            data += field.length;
+          }
+          return true;
+        }
+
+        bool split_text_row(const char* data, size_t length)
+        {
+          const char* const end = data + length - (length and data[length - 1] == '\n' ? 1 : 0);
+          fields.clear();
+          size_t index = 0;
+          for (const char* begin = data;; ++index)
+          {
+            const char* separator = begin;
+            while (separator != end and *separator != '\t')
+            {
+              ++separator;
+            }
+            if (text_fields.size() <= index)
+            {
+              text_fields.resize(index + 1);
+            }
+            auto& text = text_fields[index];
+            const auto is_null = (separator - begin == 2 and begin[0] == '\\' and begin[1] == 'N');
+            unescape(text, begin, separator);
+            fields.push_back(field_t{text.c_str(), text.size(), is_null});
+            if (separator == end)
+            {
+              return true;
+            }
+            begin = separator + 1;
+          }
+        }
+
+        static void unescape(std::string& text, const char* begin, const char* end)
+        {
+          text.clear();
+          for (; begin != end; ++begin)
+          {
+            if (*begin != '\\' or begin + 1 == end)
+            {
+              text.push_back(*begin);
+              continue;
+            }
+            switch (*++begin)
+            {
+              case 'b':
+                text.push_back('\b');
+                break;
+              case 'f':
+                text.push_back('\f');
+                break;
+              case 'n':
+                text.push_back('\n');
+                break;
+              case 'r':
+                text.push_back('\r');
+                break;
+              case 't':
+                text.push_back('\t');
+                break;
+              case 'v':
+                text.push_back('\v');
+                break;
+              default:
+                text.push_back(*begin);
+            }
+          }
+        }
+      };
+    }  // namespace detail
+
+    // Provides the rows of a COPY ... TO STDOUT to sqlpp::result_t, like bind_result_t does for selects
+    class copy_out_result_t
+    {
+    private:
+      std::shared_ptr<detail::copy_out_handle_t> _handle;
+      // Per column storage for values that need to be converted before they can be handed out
+      std::vector<std::string> _text_buffers;
+      std::vector<std::vector<uint8_t>> _blob_buffers;
+
+      template <typename Buffer>
+      Buffer& buffer(std::vector<Buffer>& buffers, size_t index)
+      {
+        if (buffers.size() <= index)
+        {
+          buffers.resize(index + 1);
+        }
+        return buffers[index];
+      }
+
+      // Returns the field, or nullptr if it is NULL
+      const detail::copy_out_handle_t::field_t* field(size_t index, bool* is_null) const
+      {
+        const auto& field = _handle->field(index);
+        *is_null = field.is_null;
+        return field.is_null ? nullptr : &field;
+      }
+
+      template <typename T>
+      static T parse_text(const detail::copy_out_handle_t::field_t& field,
+                          bool (*parse)(T&, const char*, const char*),
+                          const char* type_name)
+      {
+        auto value = T{};
+        if (field.length and not parse(value, field.data, field.data + field.length))
+        {
+          throw sqlpp::exception{"PostgreSQL error: cannot convert '" + std::string{field.data, field.length} +
+                                 "' to " + type_name};
+        }
+        return value;
+      }
+
+    public:
+      copy_out_result_t() = default;
+      copy_out_result_t(std::shared_ptr<detail::copy_out_handle_t> handle) : _handle(std::move(handle))
+      {
+      }
+
+      copy_out_result_t(const copy_out_result_t&) = delete;
+      copy_out_result_t(copy_out_result_t&&) = default;
+      copy_out_result_t& operator=(const copy_out_result_t&) = delete;
+      copy_out_result_t& operator=(copy_out_result_t&&) = default;
+      ~copy_out_result_t() = default;
+
+      bool operator==(const copy_out_result_t& rhs) const
+      {
+        return _handle == rhs._handle;
+      }
+
+      bool _zero_copy_results() const
+      {
+        return _handle and _handle->connection.config->zero_copy_results;
+      }
+
+      // Starts COPY (query) TO STDOUT, see copy_out()
+      static copy_out_result_t _start(connection_base& db, const std::string& query)
+      {
+        // Describing the query tells whether binary format can be used, without running it
+        db.validate_connection_idle();
+        auto* native = db.native_handle();
+        {
+          Result prepared;
+          prepared = PQprepare(native, "", query.c_str(), 0, nullptr);
+        }
+        Result description;
+        description = PQdescribePrepared(native, "");
+        auto types = std::vector<Oid>(static_cast<size_t>(description.field_count()));
+        auto binary = true;
+        for (size_t i = 0; i < types.size(); ++i)
+        {
+          types[i] = description.type(static_cast<int>(i));
+          binary = binary and detail::is_binary_decodable(types[i]);
+        }
+
+        const auto statement = "COPY (" + query + ") TO STDOUT" + (binary ? " WITH (FORMAT binary)" : "");
+        if (db._handle->config->debug)
+        {
+          std::cerr << "PostgreSQL debug: executing: " << statement << std::endl;
+        }
+        auto handle = std::make_shared<detail::copy_out_handle_t>(*db._handle, std::move(types), binary);
+        Result result;
+        result = PQexec(native, statement.c_str());
+        if (result.status() != PGRES_COPY_OUT)
+        {
+          throw failure{"PostgreSQL error: COPY did not start, got status " + std::string{PQresStatus(result.status())}};
+        }
+        handle->start();
+        return copy_out_result_t{std::move(handle)};
+      }
+
+      template <typename ResultRow>
+      void next(ResultRow& result_row)
+      {
+        if (_handle and _handle->next_row())
+        {
+          if (!result_row)
+          {
+            result_row._validate();
+          }
+          result_row._bind(*this);
+        }
+        else if (result_row)
+        {
+          result_row._invalidate();
+        }
+      }
+
+      void _bind_boolean_result(size_t index, signed char* value, bool* is_null)
+      {
+        *value = false;
+        if (const auto f = field(index, is_null))
+        {
+          *value = _handle->is_binary(index) ? detail::decode_binary_integral(f->data, _handle->types[index]) != 0
+                                             : f->data[0] == 't';
+        }
+      }
+
+      void _bind_floating_point_result(size_t index, double* value, bool* is_null)
+      {
+        *value = 0;
+        if (const auto f = field(index, is_null))
+        {
+          *value = _handle->is_binary(index)
+                       ? detail::decode_binary_floating_point(f->data, _handle->types[index])
+                       : parse_text<double>(*f, ::sqlpp::detail::parse_double, "floating point");
+        }
+      }
+
+      void _bind_integral_result(size_t index, int64_t* value, bool* is_null)
+      {
+        *value = 0;
+        if (const auto f = field(index, is_null))
+        {
+          *value = _handle->is_binary(index) ? detail::decode_binary_integral(f->data, _handle->types[index])
+                                             : parse_text<int64_t>(*f, ::sqlpp::detail::parse_int64, "integral");
+        }
+      }
+
+      void _bind_unsigned_integral_result(size_t index, uint64_t* value, bool* is_null)
+      {
+        *value = 0;
+        if (const auto f = field(index, is_null))
+        {
+          *value = _handle->is_binary(index)
+                       ? static_cast<uint64_t>(detail::decode_binary_integral(f->data, _handle->types[index]))
+                       : parse_text<uint64_t>(*f, ::sqlpp::detail::parse_uint64, "unsigned integral");
+        }
+      }
+
+      void _bind_text_result(size_t index, const char** value, size_t* len)
+      {
+        auto is_null = false;
+        const auto f = field(index, &is_null);
+        if (not f)
+        {
+          *value = nullptr;
+          *len = 0;
+        }
+        else if (_handle->is_binary(index))
+        {
+          auto& text = buffer(_text_buffers, index);
+          detail::decode_binary_as_text(text, f->data, f->length, _handle->types[index]);
+          *value = text.data();
+          *len = text.size();
+        }
+        else
+        {
+          *value = f->data;
+          *len = f->length;
+        }
+      }
+
+      void _bind_date_result(size_t index, ::sqlpp::chrono::day_point* value, bool* is_null)
+      {
+        *value = {};
+        if (const auto f = field(index, is_null))
+        {
+          if (_handle->is_binary(index))
+            *value = detail::decode_binary_date(f->data, _handle->types[index]);
+          else
+            ::sqlpp::detail::parse_date(*value, f->data);
+        }
+      }
+
+      // always returns UTC time for timestamp with time zone
+      void _bind_date_time_result(size_t index, ::sqlpp::chrono::microsecond_point* value, bool* is_null)
+      {
+        *value = {};
+        if (const auto f = field(index, is_null))
+        {
+          if (_handle->is_binary(index))
+            *value = detail::decode_binary_date_time(f->data, _handle->types[index]);
+          else
+            ::sqlpp::detail::parse_timestamp(*value, f->data);
+        }
+      }
+
+      // always returns UTC time for time with time zone
+      void _bind_time_of_day_result(size_t index, ::std::chrono::microseconds* value, bool* is_null)
+      {
+        *value = {};
+        if (const auto f = field(index, is_null))
+        {
+          if (_handle->is_binary(index))
+            *value = detail::decode_binary_time_of_day(f->data, _handle->types[index]);
+          else
+            ::sqlpp::detail::parse_time_of_day(*value, f->data);
+        }
+      }
+
+      void _bind_blob_result(size_t index, const uint8_t** value, size_t* len)
+      {
+        auto is_null = false;
+        const auto f = field(index, &is_null);
+        if (not f)
+        {
+          *value = nullptr;
+          *len = 0;
+        }
+        else if (_handle->is_binary(index))
+        {
+          *value = reinterpret_cast<const uint8_t*>(f->data);
+          *len = f->length;
+        }
+        else
+        {
+          // bytea in text format is hex encoded
+          auto& blob = buffer(_blob_buffers, index);
+          ::sqlpp::detail::hex_assign(blob, reinterpret_cast<const uint8_t*>(f->data), f->length);
+          *value = blob.empty() ? reinterpret_cast<const uint8_t*>(f->data) : blob.data();  // non-null even if empty
+          *len = blob.size();
+        }
+      }
+    };
+
+    // Runs a select as COPY (...) TO STDOUT and returns the rows like db(select) would, but without buffering the whole
+    // result. Binary format is used if the connector can decode all column types, text format otherwise. No other
+    // statement can be executed on the connection until all rows have been read or the result has been destroyed.
+    //
+    //   for (const auto& row : copy_out(db, select(all_of(tab)).from(tab).unconditionally())) { ... }
+    template <typename Select>
+    auto copy_out(connection_base& db, const Select& select)
+        -> result_t<copy_out_result_t, typename Select::template _result_row_t<connection_base>>
+    {
+      static_assert(is_select_t<Select>::value, "copy_out() requires a select statement");
+      run_check_t<context_t, Select>::verify();
+
+      context_t context{db};
+      serialize(select, context);
+      return {copy_out_result_t::_start(db, context.str()), select.get_dynamic_names()};
+    }
+  }  // namespace postgresql
+}  // namespace sqlpp
@@ -0,0 +1,275 @@
+#pragma once
+
+/**
+ * Copyright © 2014-2015, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <libpq-fe.h>
+#include <sqlpp11/chrono.h>
+#include <sqlpp11/detail/float_safe_ostringstream.h>
+#include <sqlpp11/exception.h>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      // OIDs of the built-in types (see catalog/pg_type.dat), these are fixed across server versions
+      constexpr Oid bool_oid = 16;
+      constexpr Oid bytea_oid = 17;
+      constexpr Oid name_oid = 19;
+      constexpr Oid int8_oid = 20;
+      constexpr Oid int2_oid = 21;
+      constexpr Oid int4_oid = 23;
+      constexpr Oid text_oid = 25;
+      constexpr Oid float4_oid = 700;
+      constexpr Oid float8_oid = 701;
+      constexpr Oid bpchar_oid = 1042;
+      constexpr Oid varchar_oid = 1043;
+      constexpr Oid date_oid = 1082;
+      constexpr Oid time_oid = 1083;
+      constexpr Oid timestamp_oid = 1114;
+      constexpr Oid timestamptz_oid = 1184;
+      constexpr Oid timetz_oid = 1266;
+
+      // Binary date and time values count from 2000-01-01 (10957 days after the unix epoch)
+      constexpr int64_t postgres_epoch_days = 10957;
+      constexpr int64_t microseconds_per_day = 86400000000LL;
+
+      // Types whose binary representation is identical to their text representation
+      inline bool is_text_type(Oid type)
+      {
+        switch (type)
+        {
+          case name_oid:
+          case text_oid:
+          case bpchar_oid:
+          case varchar_oid:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+      // Types that the connector can read in binary format
+      inline bool is_binary_decodable(Oid type)
+      {
+        switch (type)
+        {
+          case bool_oid:
+          case bytea_oid:
+          case int8_oid:
+          case int2_oid:
+          case int4_oid:
+          case float4_oid:
+          case float8_oid:
+          case date_oid:
+          case time_oid:
+          case timestamp_oid:
+          case timestamptz_oid:
+          case timetz_oid:
+            return true;
+          default:
+            return is_text_type(type);
+        }
+      }
+
+      // Binary values are sent in network byte order
+      inline uint64_t read_big_endian(const char* data, size_t size)
+      {
+        auto value = uint64_t{};
+        for (size_t i = 0; i < size; ++i)
+        {
+          value = (value << 8) | static_cast<unsigned char>(data[i]);
+        }
+        return value;
+      }
+
+      inline void append_big_endian(std::string& out, uint64_t value, size_t size)
+      {
+        while (size--)
+        {
+          out.push_back(static_cast<char>((value >> (8 * size)) & 0xFF));
+        }
+      }
+
+      inline double read_float4(const char* data)
+      {
+        const auto bits = static_cast<uint32_t>(read_big_endian(data, 4));
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+      }
+
+      inline double read_float8(const char* data)
+      {
+        const auto bits = read_big_endian(data, 8);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+      }
+
+      [[noreturn]] inline void throw_unsupported_conversion(Oid type, const char* target)
+      {
+        throw sqlpp::exception{"PostgreSQL error: cannot read binary value of type oid " + std::to_string(type) +
+                               " as " + target};
+      }
+
+      inline int64_t decode_binary_integral(const char* data, Oid type)
+      {
+        switch (type)
+        {
+          case bool_oid:
+            return data[0] != 0;
+          case int2_oid:
+            return static_cast<int16_t>(read_big_endian(data, 2));
+          case int4_oid:
+            return static_cast<int32_t>(read_big_endian(data, 4));
+          case int8_oid:
+            return static_cast<int64_t>(read_big_endian(data, 8));
+          case float4_oid:
+            return static_cast<int64_t>(read_float4(data));
+          case float8_oid:
+            return static_cast<int64_t>(read_float8(data));
+          default:
+            throw_unsupported_conversion(type, "integral");
+        }
+      }
+
+      inline double decode_binary_floating_point(const char* data, Oid type)
+      {
+        switch (type)
+        {
+          case float4_oid:
+            return read_float4(data);
+          case float8_oid:
+            return read_float8(data);
+          default:
+            return static_cast<double>(decode_binary_integral(data, type));
+        }
+      }
+
+      inline ::sqlpp::chrono::microsecond_point decode_binary_date_time(const char* data, Oid type)
+      {
+        switch (type)
+        {
+          case date_oid:
+            return ::sqlpp::chrono::day_point{
+                ::date::days{static_cast<int32_t>(read_big_endian(data, 4)) + postgres_epoch_days}};
+          case timestamp_oid:
+          case timestamptz_oid:
+            return ::sqlpp::chrono::microsecond_point{std::chrono::microseconds{
+                static_cast<int64_t>(read_big_endian(data, 8)) + postgres_epoch_days * microseconds_per_day}};
+          default:
+            throw_unsupported_conversion(type, "date or timestamp");
+        }
+      }
+
+      inline ::sqlpp::chrono::day_point decode_binary_date(const char* data, Oid type)
+      {
+        return ::sqlpp::chrono::floor<::date::days>(decode_binary_date_time(data, type));
+      }
+
+      // always returns UTC time for time with time zone
+      inline std::chrono::microseconds decode_binary_time_of_day(const char* data, Oid type)
+      {
+        switch (type)
+        {
+          case time_oid:
+            return std::chrono::microseconds{static_cast<int64_t>(read_big_endian(data, 8))};
+          case timetz_oid:
+          {
+            // The zone is stored in seconds west of UTC
+            const auto local = static_cast<int64_t>(read_big_endian(data, 8));
+            const auto zone = static_cast<int32_t>(read_big_endian(data + 8, 4));
+            const auto utc = (local + zone * 1000000LL) % microseconds_per_day;
+            return std::chrono::microseconds{utc < 0 ? utc + microseconds_per_day : utc};
+          }
+          default:
+            throw_unsupported_conversion(type, "time of day");
+        }
+      }
+
+      // Renders a binary value like the server would in text format (timestamps and times in UTC)
+      inline void decode_binary_as_text(std::string& out, const char* data, size_t len, Oid type)
+      {
+        sqlpp::detail::float_safe_ostringstream os;
+        switch (type)
+        {
+          case bool_oid:
+            out = data[0] ? "t" : "f";
+            return;
+          case int2_oid:
+          case int4_oid:
+          case int8_oid:
+            out = std::to_string(decode_binary_integral(data, type));
+            return;
+          case float4_oid:
+          case float8_oid:
+            os << decode_binary_floating_point(data, type);
+            break;
+          case bytea_oid:
+          {
+            constexpr char hex_chars[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
+                                            '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+            out.assign("\\x");
+            for (size_t i = 0; i < len; ++i)
+            {
+              out.push_back(hex_chars[static_cast<unsigned char>(data[i]) >> 4]);
+              out.push_back(hex_chars[data[i] & 0x0F]);
+            }
+            return;
+          }
+          case date_oid:
+            os << ::date::year_month_day{decode_binary_date(data, type)};
+            break;
+          case timestamp_oid:
+          case timestamptz_oid:
+          {
+            const auto value = decode_binary_date_time(data, type);
+            const auto dp = ::sqlpp::chrono::floor<::date::days>(value);
+            os << ::date::year_month_day{dp} << ' ' << ::date::make_time(value - dp)
+               << (type == timestamptz_oid ? "+00" : "");
+            break;
+          }
+          case time_oid:
+          case timetz_oid:
+            os << ::date::make_time(decode_binary_time_of_day(data, type)) << (type == timetz_oid ? "+00" : "");
+            break;
+          default:
+            out.assign(data, len);
+            return;
+        }
+        out = os.str();
+      }
+    }  // namespace detail
+  }    // namespace postgresql
+}  // namespace sqlpp
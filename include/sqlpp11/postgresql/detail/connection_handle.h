@@ -32,6 +32,7 @@
 #include <string>
 
 #include <libpq-fe.h>
+#include <sqlpp11/detail/statement_cache.h>
 #include <sqlpp11/postgresql/connection_config.h>
 #include <sqlpp11/postgresql/visibility.h>
 
@@ -52,14 +53,26 @@ namespace sqlpp
 
     namespace detail
     {
+      struct prepared_statement_handle_t;
+
       struct DLL_LOCAL connection_handle
       {
         std::shared_ptr<const connection_config> config;
         std::unique_ptr<PGconn, void(*)(PGconn*)>  postgres;
         std::set<std::string> prepared_statement_names;
+        // A result is being streamed (single row or chunked mode), no other statement can be sent until it is done
+        bool streaming = false;
+        // Prepared statements are being queued by a pipeline, see pipeline.h
+        bool pipeline = false;
+        // A COPY FROM STDIN or TO STDOUT is in progress, see copy.h
+        bool copying = false;
+        // Statements are sent without waiting for their results, see async.h
+        bool async = false;
+        // Prepared statements for reuse by prepare(), see connection_config::statement_cache_size
+        sqlpp::detail::statement_cache<prepared_statement_handle_t> statement_cache;
 
         connection_handle(const std::shared_ptr<const connection_config>& conf)
-            : config{conf}, postgres{nullptr, PQfinish}
+            : config{conf}, postgres{nullptr, PQfinish}, statement_cache{conf->statement_cache_size}
         {
 #ifdef SQLPP_DYNAMIC_LOADING
           init_pg("");
@@ -202,6 +215,9 @@ namespace sqlpp
           {
             std::cerr << "PostgreSQL debug: closing database connection." << std::endl;
           }
+          // The server drops all prepared statements with the connection, so the cached ones are not DEALLOCATEd
+          postgres.reset();
+          statement_cache.clear();
         }
 
         connection_handle& operator=(const connection_handle&) = delete;
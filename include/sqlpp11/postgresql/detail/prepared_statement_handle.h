@@ -60,6 +60,11 @@ namespace sqlpp
         int count = 0;
         int total_count = 0;
         int fields = 0;
+        result_mode mode = result_mode::buffered;
+        // The query was sent in single row or chunked mode and there are more results to fetch
+        bool streaming = false;
+        // Incremented for each streamed query, so that a result only cancels the query it consumes
+        size_t stream_id = 0;
 
         // ctor
         statement_handle_t(connection_handle& _connection) : connection(_connection)
@@ -73,6 +78,7 @@ namespace sqlpp
 
         virtual ~statement_handle_t()
         {
+          cancel_streaming();
           clear_result();
         }
 
@@ -93,6 +99,100 @@ namespace sqlpp
         {
           return connection.config->debug;
         }
+
+        // To be called right after sending a query with PQsendQuery* and friends
+        void start_streaming(result_mode new_mode, int chunk_size)
+        {
+          (void)chunk_size;  // only used in chunked mode
+          mode = new_mode;
+          auto ok = false;
+          switch (mode)
+          {
+            case result_mode::single_row:
+              ok = PQsetSingleRowMode(connection.native_handle()) == 1;
+              break;
+#if PG_MAJORVERSION_NUM >= 17
+            case result_mode::chunked:
+              ok = PQsetChunkedRowsMode(connection.native_handle(), chunk_size) == 1;
+              break;
+#endif
+            default:
+              break;
+          }
+          streaming = true;
+          connection.streaming = true;
+          ++stream_id;
+          if (not ok)
+          {
+            cancel_streaming();
+            throw failure{"PostgreSQL error: could not switch to streaming result mode"};
+          }
+        }
+
+        // Replaces the current result with the next chunk of rows of a streamed query.
+        // Returns false if the query is complete (or if it is not streamed at all).
+        bool fetch_next_result()
+        {
+          if (not streaming)
+          {
+            return false;
+          }
+          clear_result();
+          count = 0;
+          total_count = 0;
+          while (PGresult* res = PQgetResult(connection.native_handle()))
+          {
+            switch (PQresultStatus(res))
+            {
+              case PGRES_SINGLE_TUPLE:
+#if PG_MAJORVERSION_NUM >= 17
+              case PGRES_TUPLES_CHUNK:
+#endif
+                result = res;
+                total_count = result.records_size();
+                return true;
+              case PGRES_TUPLES_OK:
+                // The zero-row result that marks the end of the result set
+                PQclear(res);
+                break;
+              default:
+                // Consume whatever is left so that the connection can be used again, then report errors (if any)
+                finish_streaming();
+                result = res;
+                clear_result();
+                return false;
+            }
+          }
+          finish_streaming();
+          return false;
+        }
+
+        // Aborts a streamed query that has not been read completely
+        void cancel_streaming()
+        {
+          if (not streaming)
+          {
+            return;
+          }
+          if (PGcancel* cancel = PQgetCancel(connection.native_handle()))
+          {
+            char error[256];
+            PQcancel(cancel, error, sizeof(error));
+            PQfreeCancel(cancel);
+          }
+          finish_streaming();
+        }
+
+      private:
+        void finish_streaming()
+        {
+          while (PGresult* res = PQgetResult(connection.native_handle()))
+          {
+            PQclear(res);
+          }
+          streaming = false;
+          connection.streaming = false;
+        }
       };
 
       struct prepared_statement_handle_t : public statement_handle_t
@@ -104,6 +204,11 @@ namespace sqlpp
         // Store prepared statement arguments
         std::vector<bool> null_values;
         std::vector<std::string> param_values;
+        // Binary format (see connection_config::binary_format), all empty if not enabled
+        std::vector<Oid> param_types;  // as inferred by the server
+        std::vector<int> param_formats;
+        std::vector<int> param_lengths;
+        int result_format = 0;
 
         // ctor
         prepared_statement_handle_t(connection_handle& _connection, const std::string& stmt, const size_t& param_count) :
@@ -113,6 +218,10 @@ namespace sqlpp
         {
           generate_name();
           prepare(std::move(stmt));
+          if (connection.config->binary_format)
+          {
+            describe();
+          }
         }
 
         prepared_statement_handle_t(const prepared_statement_handle_t&) = delete;
@@ -122,36 +231,79 @@ namespace sqlpp
 
         virtual ~prepared_statement_handle_t()
         {
+          cancel_streaming();
           if (valid && !_name.empty())
           {
             connection.deallocate_prepared_statement(_name);
           }
         }
 
-        void execute()
+        void execute(result_mode new_mode = result_mode::buffered, int chunk_size = 0)
         {
-          const size_t size = param_values.size();
-
-          std::vector<const char*> values;
-          for (size_t i = 0u; i < size; i++)
-            values.push_back(null_values[i] ? nullptr : const_cast<char*>(param_values[i].c_str()));
-
           // Execute prepared statement with the parameters.
           clear_result();
           valid = false;
           count = 0;
           total_count = 0;
-          result = PQexecPrepared(connection.native_handle(), _name.data(), static_cast<int>(size), values.data(), nullptr, nullptr, 0);
-                  /// @todo validate result? is it really valid
+          mode = new_mode;
+          if (mode == result_mode::buffered)
+          {
+            bind_param_pointers();
+            result = PQexecPrepared(connection.native_handle(), _name.data(), static_cast<int>(_param_pointers.size()),
+                                    _param_pointers.data(), _lengths, _formats, result_format);
+                    /// @todo validate result? is it really valid
+          }
+          else
+          {
+            send();
+            start_streaming(mode, chunk_size);
+          }
           valid = true;
         }
 
+        // Sends the statement with the current parameters without waiting for the result (streaming or pipeline mode)
+        void send()
+        {
+          bind_param_pointers();
+          if (PQsendQueryPrepared(connection.native_handle(), _name.data(), static_cast<int>(_param_pointers.size()),
+                                  _param_pointers.data(), _lengths, _formats, result_format) != 1)
+          {
+            throw failure{std::string{PQerrorMessage(connection.native_handle())}};
+          }
+        }
+
         std::string name() const
         {
           return _name;
         }
 
+        // Called by the statement cache when the statement is not used anymore
+        void recycle()
+        {
+          cancel_streaming();
+          clear_result();
+        }
+
       private:
+        std::vector<const char*> _param_pointers;
+        const int* _formats = nullptr;
+        const int* _lengths = nullptr;
+
+        void bind_param_pointers()
+        {
+          const size_t size = param_values.size();
+          _param_pointers.resize(size);
+          for (size_t i = 0u; i < size; i++)
+            _param_pointers[i] = null_values[i] ? nullptr : param_values[i].c_str();
+          if (not param_formats.empty())
+          {
+            for (size_t i = 0u; i < size; i++)
+              param_lengths[i] = static_cast<int>(param_values[i].size());
+            _formats = param_formats.data();
+            _lengths = param_lengths.data();
+          }
+        }
+
         void generate_name()
         {
           // Generate a random name for the prepared statement
@@ -174,6 +326,28 @@ namespace sqlpp
           result = PQprepare(connection.native_handle(), _name.c_str(), stmt.c_str(), 0, nullptr);
           valid = true;
         }
+
+        // Asks the server for the parameter and result types of the statement. Parameters are sent in binary format
+        // if their type is known, results are requested in binary format if all columns can be decoded.
+        void describe()
+        {
+          Result description;
+          description = PQdescribePrepared(connection.native_handle(), _name.c_str());
+
+          const auto size = param_values.size();
+          param_types.resize(size);
+          param_formats.assign(size, 0);
+          param_lengths.assign(size, 0);
+          for (size_t i = 0u; i < size && i < static_cast<size_t>(description.param_count()); i++)
+            param_types[i] = description.param_type(static_cast<int>(i));
+
+          result_format = description.field_count() > 0 ? 1 : 0;
+          for (int i = 0; i < description.field_count(); i++)
+          {
+            if (not detail::is_binary_decodable(description.type(i)))
+              result_format = 0;
+          }
+        }
       };
     }
   }
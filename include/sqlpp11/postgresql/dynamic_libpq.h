@@ -29,6 +29,7 @@
 #include <stdexcept>
 
 #include <libpq-fe.h>
+#include <pg_config.h>
 
 #ifdef SQLPP_DYNAMIC_LOADING
 
@@ -120,6 +121,32 @@ DYNDEFINE(PQexec);
 DYNDEFINE(PQprepare);
 DYNDEFINE(PQexecPrepared);
 DYNDEFINE(PQexecParams);
+DYNDEFINE(PQdescribePrepared);
+DYNDEFINE(PQsendQuery);
+DYNDEFINE(PQsendQueryPrepared);
+DYNDEFINE(PQsetSingleRowMode);
+#if PG_MAJORVERSION_NUM >= 17
+DYNDEFINE(PQsetChunkedRowsMode);
+#endif
+DYNDEFINE(PQgetResult);
+DYNDEFINE(PQputCopyData);
+DYNDEFINE(PQputCopyEnd);
+DYNDEFINE(PQgetCopyData);
+DYNDEFINE(PQsetnonblocking);
+DYNDEFINE(PQisnonblocking);
+DYNDEFINE(PQflush);
+DYNDEFINE(PQconsumeInput);
+DYNDEFINE(PQisBusy);
+DYNDEFINE(PQsocket);
+#if PG_MAJORVERSION_NUM >= 14
+DYNDEFINE(PQenterPipelineMode);
+DYNDEFINE(PQexitPipelineMode);
+DYNDEFINE(PQpipelineSync);
+DYNDEFINE(PQsendFlushRequest);
+#endif
+DYNDEFINE(PQgetCancel);
+DYNDEFINE(PQcancel);
+DYNDEFINE(PQfreeCancel);
 DYNDEFINE(PQresultStatus);
 DYNDEFINE(PQresStatus);
 DYNDEFINE(PQresultErrorMessage);
@@ -132,9 +159,11 @@ DYNDEFINE(PQgetisnull);
 DYNDEFINE(PQoidValue);
 DYNDEFINE(PQoidStatus);
 DYNDEFINE(PQfformat);
+DYNDEFINE(PQftype);
 DYNDEFINE(PQntuples);
 DYNDEFINE(PQnfields);
 DYNDEFINE(PQnparams);
+DYNDEFINE(PQparamtype);
 DYNDEFINE(PQclear);
 DYNDEFINE(PQfinish);
 DYNDEFINE(PQstatus);
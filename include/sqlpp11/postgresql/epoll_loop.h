@@ -0,0 +1,163 @@
+#pragma once
+
+/**
+ * Copyright © 2014-2015, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp11/compat/sqlpp_cxx_std.h>
+#include <sqlpp11/postgresql/async.h>
+
+#if SQLPP_CXX_STD >= 202002L && defined(__linux__)
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    // A reference event loop that serves any number of connections on one thread, using epoll:
+    //
+    //   sqlpp::postgresql::epoll_loop loop;
+    //   std::vector<std::unique_ptr<sqlpp::postgresql::async_executor>> executors;  // one per connection
+    //   std::vector<sqlpp::postgresql::task> tasks;
+    //   for (auto& executor : executors)
+    //   {
+    //     loop.add(*executor);
+    //     tasks.push_back(handle_requests(*executor));  // a coroutine that co_awaits (*executor)(statement)
+    //   }
+    //   loop.run();
+    //
+    // run() returns once no executor has pending statements, i.e. once all coroutines are done or waiting for
+    // something other than a statement.
+    class epoll_loop
+    {
+    public:
+      epoll_loop() : _fd(epoll_create1(EPOLL_CLOEXEC))
+      {
+        if (_fd < 0)
+        {
+          throw sqlpp::exception{std::string{"epoll error: could not create epoll instance: "} + std::strerror(errno)};
+        }
+      }
+
+      epoll_loop(const epoll_loop&) = delete;
+      epoll_loop(epoll_loop&&) = delete;
+      epoll_loop& operator=(const epoll_loop&) = delete;
+      epoll_loop& operator=(epoll_loop&&) = delete;
+
+      ~epoll_loop()
+      {
+        close(_fd);
+      }
+
+      // The executor has to stay alive until it is removed again or the loop is destroyed
+      void add(async_executor& executor)
+      {
+        auto event = epoll_event{};
+        event.events = EPOLLIN;
+        event.data.ptr = &executor;
+        control(EPOLL_CTL_ADD, executor, event);
+        _registrations.push_back({&executor, false});
+      }
+
+      void remove(async_executor& executor)
+      {
+        auto event = epoll_event{};
+        control(EPOLL_CTL_DEL, executor, event);
+        _registrations.erase(std::remove_if(_registrations.begin(), _registrations.end(),
+                                            [&](const registration& r) { return r.executor == &executor; }),
+                             _registrations.end());
+      }
+
+      // Processes the executors as their sockets become ready, until none of them has pending statements
+      void run()
+      {
+        std::vector<epoll_event> events;
+        while (true)
+        {
+          auto pending = false;
+          for (auto& r : _registrations)
+          {
+            pending = pending or r.executor->pending() > 0;
+            // Wait for the socket to become writable only while there is something left to send
+            if (r.writing != r.executor->wants_write())
+            {
+              r.writing = not r.writing;
+              auto event = epoll_event{};
+              event.events = r.writing ? EPOLLIN | EPOLLOUT : EPOLLIN;
+              event.data.ptr = r.executor;
+              control(EPOLL_CTL_MOD, *r.executor, event);
+            }
+          }
+          if (not pending)
+          {
+            return;
+          }
+
+          events.resize(_registrations.size());
+          const int count = epoll_wait(_fd, events.data(), static_cast<int>(events.size()), -1);
+          if (count < 0)
+          {
+            if (errno == EINTR)
+            {
+              continue;
+            }
+            throw sqlpp::exception{std::string{"epoll error: could not wait for events: "} + std::strerror(errno)};
+          }
+          for (int i = 0; i < count; ++i)
+          {
+            static_cast<async_executor*>(events[static_cast<size_t>(i)].data.ptr)->process();
+          }
+        }
+      }
+
+    private:
+      struct registration
+      {
+        async_executor* executor;
+        bool writing;  // EPOLLOUT is requested
+      };
+
+      int _fd;
+      std::vector<registration> _registrations;
+
+      void control(int operation, async_executor& executor, epoll_event& event)
+      {
+        if (epoll_ctl(_fd, operation, executor.socket(), &event) != 0)
+        {
+          throw sqlpp::exception{std::string{"epoll error: could not register connection: "} + std::strerror(errno)};
+        }
+      }
+    };
+  }  // namespace postgresql
+}  // namespace sqlpp
+#endif
@@ -0,0 +1,250 @@
+#pragma once
+
+/**
+ * Copyright © 2014-2015, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <exception>
+#include <iostream>
+#include <vector>
+
+#include <sqlpp11/postgresql/connection.h>
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+
+    // Outcome of a statement executed in a pipeline
+    struct pipeline_result
+    {
+      size_t affected_rows{0};
+      std::exception_ptr error;  // set if the statement failed (or was skipped due to an earlier failure)
+
+      explicit operator bool() const
+      {
+        return not error;
+      }
+    };
+
+    // Sends prepared statements to the server without waiting for their results, using libpq's pipeline mode
+    // (libpq >= 14). Results are collected by sync(), in the order the statements were queued.
+    //
+    //   auto insert = db.prepare(insert_into(tab).set(tab.alpha = parameter(tab.alpha)));
+    //   sqlpp::postgresql::pipeline pipeline{db};
+    //   for (const auto& value : values)
+    //   {
+    //     insert.params.alpha = value;
+    //     pipeline(insert);
+    //   }
+    //   for (const auto& result : pipeline.sync()) { ... }
+    //
+    // Unless a transaction is active, all statements up to a sync() form an implicit transaction. Once a statement
+    // fails, the remaining statements up to the next sync() are skipped. No other statements can be executed on the
+    // connection while the pipeline exists. Destroying the pipeline syncs it, discarding the results.
+    //
+    // With older versions of libpq, statements are executed one by one when they are queued (with the same handling
+    // of errors, but without the implicit transaction).
+    class pipeline
+    {
+    public:
+      // At most max_pending results are left unread, the oldest are read as more statements are queued
+      explicit pipeline(connection_base& db, size_t max_pending = 1000) : _db(db), _max_pending(max_pending)
+      {
+        _db.validate_connection_idle();
+#if PG_MAJORVERSION_NUM >= 14
+        if (PQenterPipelineMode(native_handle()) != 1)
+        {
+          throw failure{std::string{PQerrorMessage(native_handle())}};
+        }
+        // Sending never blocks in non-blocking mode, PQgetResult takes care of flushing while waiting for results
+        _was_nonblocking = PQisnonblocking(native_handle()) == 1;
+        PQsetnonblocking(native_handle(), 1);
+#endif
+        _db._handle->pipeline = true;
+      }
+
+      pipeline(const pipeline&) = delete;
+      pipeline(pipeline&&) = delete;
+      pipeline& operator=(const pipeline&) = delete;
+      pipeline& operator=(pipeline&&) = delete;
+
+      ~pipeline()
+      {
+        try
+        {
+          sync();
+        }
+        catch (const std::exception& e)
+        {
+          std::cerr << "PostgreSQL error: could not sync pipeline: " << e.what() << std::endl;
+        }
+#if PG_MAJORVERSION_NUM >= 14
+        PQexitPipelineMode(native_handle());
+        PQsetnonblocking(native_handle(), _was_nonblocking ? 1 : 0);
+#endif
+        _db._handle->pipeline = false;
+      }
+
+      // Queues a prepared statement with its current parameters
+      template <typename PreparedStatement>
+      void operator()(const PreparedStatement& statement)
+      {
+        statement._bind_params();
+        auto& prepared = statement._prepared_statement._handle;
+        if (_db._handle->config->debug)
+        {
+          std::cerr << "PostgreSQL debug: queueing: " << prepared->name() << std::endl;
+        }
+#if PG_MAJORVERSION_NUM >= 14
+        prepared->send();
+        ++_pending;
+        if (_pending > _max_pending)
+        {
+          PQsendFlushRequest(native_handle());
+          read_result();
+        }
+#else
+        if (_aborted)
+        {
+          add_aborted_result();
+          return;
+        }
+        auto result = pipeline_result{};
+        try
+        {
+          prepared->execute();
+          result.affected_rows = static_cast<size_t>(prepared->result.affected_rows());
+        }
+        catch (const std::exception&)
+        {
+          result.error = std::current_exception();
+          _aborted = true;
+        }
+        _results.push_back(std::move(result));
+#endif
+      }
+
+      // Waits for all queued statements and returns their results (since the previous sync)
+      std::vector<pipeline_result> sync()
+      {
+#if PG_MAJORVERSION_NUM >= 14
+        if (PQpipelineSync(native_handle()) != 1)
+        {
+          throw failure{std::string{PQerrorMessage(native_handle())}};
+        }
+        while (_pending)
+        {
+          read_result();
+        }
+        PGresult* res = PQgetResult(native_handle());
+        const auto status = res ? PQresultStatus(res) : PGRES_FATAL_ERROR;
+        PQclear(res);
+        if (status != PGRES_PIPELINE_SYNC)
+        {
+          throw failure{"PostgreSQL error: unexpected result while syncing pipeline: " +
+                        std::string{PQerrorMessage(native_handle())}};
+        }
+#else
+        _aborted = false;
+#endif
+        auto results = std::move(_results);
+        _results.clear();
+        return results;
+      }
+
+      // Number of queued statements whose results have not been read yet
+      size_t pending() const
+      {
+        return _pending;
+      }
+
+    private:
+      connection_base& _db;
+      size_t _max_pending;
+      size_t _pending{0};
+      std::vector<pipeline_result> _results;
+#if PG_MAJORVERSION_NUM >= 14
+      bool _was_nonblocking{false};
+#else
+      bool _aborted{false};
+#endif
+
+      PGconn* native_handle() const
+      {
+        return _db.native_handle();
+      }
+
+      void add_aborted_result()
+      {
+        auto result = pipeline_result{};
+        result.error = std::make_exception_ptr(
+            failure{"PostgreSQL error: statement skipped, an earlier statement in the pipeline failed"});
+        _results.push_back(std::move(result));
+      }
+
+#if PG_MAJORVERSION_NUM >= 14
+      // Reads the result of the oldest pending statement
+      void read_result()
+      {
+        --_pending;
+        PGresult* res = PQgetResult(native_handle());
+        // Each statement's results are terminated by a null pointer
+        while (PGresult* trailing = res ? PQgetResult(native_handle()) : nullptr)
+        {
+          PQclear(trailing);
+        }
+        if (res and PQresultStatus(res) == PGRES_PIPELINE_ABORTED)
+        {
+          PQclear(res);
+          add_aborted_result();
+          return;
+        }
+
+        auto result = pipeline_result{};
+        try
+        {
+          Result owner;
+          owner = res;
+          result.affected_rows = static_cast<size_t>(owner.affected_rows());
+        }
+        catch (const std::exception&)
+        {
+          result.error = std::current_exception();
+        }
+        _results.push_back(std::move(result));
+      }
+#endif
+    };
+  }  // namespace postgresql
+}  // namespace sqlpp
@@ -28,9 +28,12 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sqlpp11/postgresql/async.h>
 #include <sqlpp11/postgresql/connection.h>
 #include <sqlpp11/postgresql/connection_pool.h>
+#include <sqlpp11/postgresql/copy.h>
 #include <sqlpp11/postgresql/exception.h>
 #include <sqlpp11/postgresql/insert.h>
+#include <sqlpp11/postgresql/pipeline.h>
 #include <sqlpp11/postgresql/remove.h>
 #include <sqlpp11/postgresql/update.h>
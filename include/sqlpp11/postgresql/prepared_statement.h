@@ -28,11 +28,14 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 #include <sqlpp11/chrono.h>
 #include <sqlpp11/detail/float_safe_ostringstream.h>
 #include <sqlpp11/postgresql/exception.h>
+#include <sqlpp11/postgresql/detail/binary_format.h>
 
 namespace sqlpp
 {
@@ -44,20 +47,83 @@ namespace sqlpp
 
     // Forward declaration
     class connection_base;
+    class pipeline;
+    class async_executor;
 
     // Detail namespace
     namespace detail
     {
       struct prepared_statement_handle_t;
-    }
+
+      // Elements of list parameters, which are bound as array literals
+      inline void append_array_element(std::string& array, bool value)
+      {
+        array += value ? 't' : 'f';
+      }
+
+      inline void append_array_element(std::string& array, int64_t value)
+      {
+        array += std::to_string(value);
+      }
+
+      inline void append_array_element(std::string& array, uint64_t value)
+      {
+        array += std::to_string(value);
+      }
+
+      inline void append_array_element(std::string& array, double value)
+      {
+        sqlpp::detail::float_safe_ostringstream out;
+        out << value;
+        array += out.str();
+      }
+
+      inline void append_array_element(std::string& array, const std::string& value)
+      {
+        array += '"';
+        for (const auto c : value)
+        {
+          if (c == '"' or c == '\\')
+          {
+            array += '\\';
+          }
+          array += c;
+        }
+        array += '"';
+      }
+    }  // namespace detail
 
     class prepared_statement_t
     {
     private:
       friend class sqlpp::postgresql::connection_base;
+      friend class sqlpp::postgresql::pipeline;
+      friend class sqlpp::postgresql::async_executor;
 
       std::shared_ptr<detail::prepared_statement_handle_t> _handle;
 
+      // The parameter type as inferred by the server if binary format is enabled, 0 otherwise
+      Oid param_type(size_t index) const
+      {
+        return _handle->param_types.empty() ? 0 : _handle->param_types[index];
+      }
+
+      std::string& binary_param(size_t index)
+      {
+        _handle->param_formats[index] = 1;
+        _handle->param_values[index].clear();
+        return _handle->param_values[index];
+      }
+
+      std::string& text_param(size_t index)
+      {
+        if (not _handle->param_formats.empty())
+        {
+          _handle->param_formats[index] = 0;
+        }
+        return _handle->param_values[index];
+      }
+
     public:
       prepared_statement_t() = default;
 
@@ -94,13 +160,17 @@ namespace sqlpp
         _handle->null_values[index] = is_null;
         if (!is_null)
         {
-          if (*value)
+          if (param_type(index) == detail::bool_oid)
           {
-            _handle->param_values[index] = "TRUE";
+            binary_param(index).push_back(*value ? 1 : 0);
+          }
+          else if (*value)
+          {
+            text_param(index) = "TRUE";
           }
           else
           {
-            _handle->param_values[index] = "FALSE";
+            text_param(index) = "FALSE";
           }
         }
       }
@@ -116,9 +186,25 @@ namespace sqlpp
         _handle->null_values[index] = is_null;
         if (!is_null)
         {
-          sqlpp::detail::float_safe_ostringstream out;
-          out << *value;
-          _handle->param_values[index] = out.str();
+          if (param_type(index) == detail::float8_oid)
+          {
+            uint64_t bits;
+            std::memcpy(&bits, value, sizeof(bits));
+            detail::append_big_endian(binary_param(index), bits, 8);
+          }
+          else if (param_type(index) == detail::float4_oid)
+          {
+            const auto narrowed = static_cast<float>(*value);
+            uint32_t bits;
+            std::memcpy(&bits, &narrowed, sizeof(bits));
+            detail::append_big_endian(binary_param(index), bits, 4);
+          }
+          else
+          {
+            sqlpp::detail::float_safe_ostringstream out;
+            out << *value;
+            text_param(index) = out.str();
+          }
         }
       }
 
@@ -134,7 +220,26 @@ namespace sqlpp
         _handle->null_values[index] = is_null;
         if (!is_null)
         {
-          _handle->param_values[index] = std::to_string(*value);
+          // Values that do not fit are sent as text, so that the server reports the overflow
+          const auto type = param_type(index);
+          if (type == detail::int8_oid)
+          {
+            detail::append_big_endian(binary_param(index), static_cast<uint64_t>(*value), 8);
+          }
+          else if (type == detail::int4_oid and *value >= std::numeric_limits<int32_t>::min() and
+                   *value <= std::numeric_limits<int32_t>::max())
+          {
+            detail::append_big_endian(binary_param(index), static_cast<uint64_t>(*value), 4);
+          }
+          else if (type == detail::int2_oid and *value >= std::numeric_limits<int16_t>::min() and
+                   *value <= std::numeric_limits<int16_t>::max())
+          {
+            detail::append_big_endian(binary_param(index), static_cast<uint64_t>(*value), 2);
+          }
+          else
+          {
+            text_param(index) = std::to_string(*value);
+          }
         }
       }
 
@@ -150,7 +255,7 @@ namespace sqlpp
         _handle->null_values[index] = is_null;
         if (!is_null)
         {
-          _handle->param_values[index] = *value;
+          text_param(index) = *value;
         }
       }
 
@@ -162,12 +267,17 @@ namespace sqlpp
                     << index << ", being " << (is_null ? "" : "not ") << "null" <<  std::endl;
         }
         _handle->null_values[index] = is_null;
-        if (not is_null)
+        if (not is_null and param_type(index) == detail::date_oid)
+        {
+          detail::append_big_endian(binary_param(index),
+                                    static_cast<uint64_t>(value->time_since_epoch().count() - detail::postgres_epoch_days), 4);
+        }
+        else if (not is_null)
         {
           const auto ymd = ::date::year_month_day{*value};
           std::ostringstream os;
           os << ymd;
-          _handle->param_values[index] = os.str();
+          text_param(index) = os.str();
 
           if (_handle->debug())
           {
@@ -184,14 +294,24 @@ namespace sqlpp
                     << index << ", being " << (is_null ? "" : "not ") << "null" <<  std::endl;
         }
         _handle->null_values[index] = is_null;
-        if (not is_null)
+        const auto type = param_type(index);
+        if (not is_null and (type == detail::time_oid or type == detail::timetz_oid))
+        {
+          auto& param = binary_param(index);
+          detail::append_big_endian(param, static_cast<uint64_t>(value->count()), 8);
+          if (type == detail::timetz_oid)
+          {
+            detail::append_big_endian(param, 0, 4);  // UTC
+          }
+        }
+        else if (not is_null)
         {
           const auto time = ::date::make_time(*value) ;
 
           // Timezone handling - always treat the local value as UTC.
           std::ostringstream os;
           os << time << "+00";
-          _handle->param_values[index] = os.str();
+          text_param(index) = os.str();
           if (_handle->debug())
           {
             std::cerr << "PostgreSQL debug: binding time parameter string: " << _handle->param_values[index] << std::endl;
@@ -207,7 +327,14 @@ namespace sqlpp
             << index << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
         }
         _handle->null_values[index] = is_null;
-        if (not is_null)
+        const auto type = param_type(index);
+        if (not is_null and (type == detail::timestamp_oid or type == detail::timestamptz_oid))
+        {
+          const auto us = ::sqlpp::chrono::floor<::std::chrono::microseconds>(*value).time_since_epoch().count();
+          detail::append_big_endian(binary_param(index),
+                                    static_cast<uint64_t>(us - detail::postgres_epoch_days * detail::microseconds_per_day), 8);
+        }
+        else if (not is_null)
         {
           const auto dp = ::sqlpp::chrono::floor<::date::days>(*value);
           const auto time = ::date::make_time(::sqlpp::chrono::floor<::std::chrono::microseconds>(*value - dp));
@@ -216,7 +343,7 @@ namespace sqlpp
           // Timezone handling - always treat the local value as UTC.
           std::ostringstream os;
           os << ymd << ' ' << time << "+00";
-          _handle->param_values[index] = os.str();
+          text_param(index) = os.str();
           if (_handle->debug())
           {
             std::cerr << "PostgreSQL debug: binding date_time parameter string: " << _handle->param_values[index] << std::endl;
@@ -224,6 +351,28 @@ namespace sqlpp
         }
       }
 
+      // The values are bound as a single array, see list_parameter.h
+      template <typename Element>
+      void _bind_list_parameter(size_t index, const std::vector<Element>* values)
+      {
+        auto& param = text_param(index);
+        param = "{";
+        for (const auto& value : *values)
+        {
+          if (param.size() > 1)
+          {
+            param += ',';
+          }
+          detail::append_array_element(param, value);
+        }
+        param += '}';
+        _handle->null_values[index] = false;
+        if (_handle->debug())
+        {
+          std::cerr << "PostgreSQL debug: binding list parameter " << param << " at index: " << index << std::endl;
+        }
+      }
+
       void _bind_blob_parameter(size_t index, const std::vector<unsigned char>* value, bool is_null)
       {
         if (_handle->debug())
@@ -232,7 +381,11 @@ namespace sqlpp
             << index << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
         }
         _handle->null_values[index] = is_null;
-        if (not is_null)
+        if (not is_null and param_type(index) == detail::bytea_oid)
+        {
+          binary_param(index).assign(value->begin(), value->end());
+        }
+        else if (not is_null)
         {
           constexpr char hex_chars[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
           auto param = std::string(value->size() * 2 + 2, '\0');  // ()-init for correct constructor
@@ -244,7 +397,7 @@ namespace sqlpp
             param[++i] = hex_chars[c >> 4];
             param[++i] = hex_chars[c & 0x0F];
           }
-          _handle->param_values[index] = std::move(param);
+          text_param(index) = std::move(param);
           if (_handle->debug())
           {
             std::cerr << "PostgreSQL debug: binding blob parameter string (up to 100 chars): " << _handle->param_values[index].substr(0, 100) << std::endl;
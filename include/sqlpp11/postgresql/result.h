@@ -35,8 +35,10 @@
 #include <pg_config.h>
 #include <libpq-fe.h>
 
+#include <sqlpp11/detail/parse_number.h>
 #include <sqlpp11/postgresql/visibility.h>
 #include <sqlpp11/postgresql/exception.h>
+#include <sqlpp11/postgresql/detail/binary_format.h>
 
 #ifdef SQLPP_DYNAMIC_LOADING
 #include <sqlpp11/postgresql/dynamic_libpq.h>
@@ -50,6 +52,16 @@ namespace sqlpp
     using namespace dynamic;
 #endif
 
+    // How the rows of a select are transferred from the server
+    enum class result_mode
+    {
+      buffered,    // the whole result is materialized in client memory before the first row is returned (default)
+      single_row,  // rows are streamed one by one (PQsetSingleRowMode)
+#if PG_MAJORVERSION_NUM >= 17
+      chunked,  // rows are streamed in chunks of up to chunk_size rows (PQsetChunkedRowsMode)
+#endif
+    };
+
     class DLL_PUBLIC Result
     {
     public:
@@ -102,6 +114,27 @@ namespace sqlpp
         return PQgetisnull(m_result, record, field);
       }
 
+      int param_count() const
+      {
+        return m_result ? PQnparams(m_result) : 0;
+      }
+
+      Oid param_type(int param) const
+      {
+        return PQparamtype(m_result, param);
+      }
+
+      Oid type(int field) const
+      {
+        return PQftype(m_result, field);
+      }
+
+      // True if the field was transferred in binary format and has to be decoded (see connection_config::binary_format)
+      bool is_binary(int field) const
+      {
+        return PQfformat(m_result, field) == 1 and not detail::is_text_type(type(field));
+      }
+
       void operator=(PGresult* res)
       {
         m_result = res;
@@ -116,40 +149,36 @@ namespace sqlpp
       int64_t get_int64_value(int record, int field) const
       {
         check_index(record, field);
-        auto t = int64_t{};
-        const auto txt = std::string{get_pq_value(m_result, record, field)};
-        if(txt != "")
+        if (is_binary(field))
         {
-          t = std::stoll(txt);
+          return is_null(record, field) ? 0
+                                        : detail::decode_binary_integral(get_pq_value(m_result, record, field), type(field));
         }
-
-        return t;
+        return parse_text_value<int64_t>(record, field, ::sqlpp::detail::parse_int64, "integral");
       }
 
       uint64_t get_uint64_value(int record, int field) const
       {
         check_index(record, field);
-        auto t = uint64_t{};
-        const auto txt = std::string{get_pq_value(m_result, record, field)};
-        if(txt != "")
+        if (is_binary(field))
         {
-          t = std::stoull(txt);
+          return is_null(record, field) ? 0
+                                        : static_cast<uint64_t>(detail::decode_binary_integral(
+                                              get_pq_value(m_result, record, field), type(field)));
         }
-
-        return t;
+        return parse_text_value<uint64_t>(record, field, ::sqlpp::detail::parse_uint64, "unsigned integral");
       }
 
       double get_double_value(int record, int field) const
       {
         check_index(record, field);
-        auto t = double{};
-        auto txt = std::string{get_pq_value(m_result, record, field)};
-        if(txt != "")
+        if (is_binary(field))
         {
-          t = std::stod(txt);
+          return is_null(record, field)
+                     ? 0.0
+                     : detail::decode_binary_floating_point(get_pq_value(m_result, record, field), type(field));
         }
-
-        return t;
+        return parse_text_value<double>(record, field, ::sqlpp::detail::parse_double, "floating point");
       }
 
       const char* get_char_ptr_value(int record, int field) const
@@ -171,6 +200,8 @@ namespace sqlpp
       {
         check_index(record, field);
         auto val = get_pq_value(m_result, record, field);
+        if (is_binary(field))
+          return not is_null(record, field) and detail::decode_binary_integral(val, type(field)) != 0;
         if (*val == 't')
           return true;
         else if (*val == 'f')
@@ -305,6 +336,10 @@ namespace sqlpp
           case PGRES_EMPTY_QUERY:  // The string sent to the backend was empty.
           case PGRES_COMMAND_OK:   // Successful completion of a command returning no data
           case PGRES_TUPLES_OK:    // The query successfully executed
+          case PGRES_SINGLE_TUPLE: // A single row of a result in single row mode
+#if PG_MAJORVERSION_NUM >= 17
+          case PGRES_TUPLES_CHUNK: // A chunk of rows of a result in chunked mode
+#endif
             break;
 
           case PGRES_COPY_OUT:  // Copy Out (from server) data transfer started
@@ -318,7 +353,6 @@ namespace sqlpp
             break;
   #if PG_MAJORVERSION_NUM >= 13
           case PGRES_COPY_BOTH:
-          case PGRES_SINGLE_TUPLE:
   #endif
   #if PG_MAJORVERSION_NUM >= 14
           case PGRES_PIPELINE_SYNC:
@@ -349,6 +383,18 @@ namespace sqlpp
           throw std::out_of_range{"PostgreSQL error: index out of range"};
       }
 
+      template <typename T>
+      T parse_text_value(int record, int field, bool (*parse)(T&, const char*, const char*), const char* type_name) const
+      {
+        const char* txt = get_pq_value(m_result, record, field);
+        auto t = T{};
+        if (*txt and not parse(t, txt, txt + length(record, field)))
+        {
+          throw sqlpp::exception{std::string{"PostgreSQL error: cannot convert '"} + txt + "' to " + type_name};
+        }
+        return t;
+      }
+
       // move PQgetvalue to implementation so we don't depend on the libpq in the
       // public interface
       const char* get_pq_value(PGresult* result, int record, int field) const
@@ -91,30 +91,4 @@ namespace sqlpp
       }
     }
   }  // namespace detail
-
-  template <typename NameType, bool CanBeNull>
-  struct result_field_t<postgresql::connection_base, field_spec_t<NameType, blob, CanBeNull>>
-      : public result_field_base<postgresql::connection_base, field_spec_t<NameType, blob, CanBeNull>>
-  {
-  private:
-    const uint8_t* _blob{nullptr};  // Non-owning
-
-  public:
-    size_t len{};
-
-    template <typename Target>
-    void _bind(Target& target, size_t index)
-    {
-      target._bind_blob_result(index, &_blob, &len);
-      if (_blob)
-      {
-        detail::hex_assign(this->_value, _blob, len);
-        len = this->_value.size();
-      }
-      else
-        this->_value.clear();
-      this->_is_null = (_blob == nullptr);
-    }
-
-  };
 }  // namespace sqlpp
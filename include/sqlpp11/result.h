@@ -27,6 +27,7 @@
  */
 
 #include <sqlpp11/compat/sqlpp_cxx_std.h>
+#include <sqlpp11/result_field_base.h>
 
 #include <functional>
 #include <iterator>
@@ -75,9 +76,24 @@ namespace sqlpp
     }
 
     result_t(const result_t&) = delete;
-    result_t(result_t&&) = default;
+    result_t(result_t&& rhs)
+        : _result(std::move(rhs._result)),
+          _result_row(std::move(rhs._result_row)),
+          _end(std::move(rhs._end)),
+          _end_row(std::move(rhs._end_row))
+    {
+      _rebind_lazy_fields();
+    }
     result_t& operator=(const result_t&) = delete;
-    result_t& operator=(result_t&&) = default;
+    result_t& operator=(result_t&& rhs)
+    {
+      _result = std::move(rhs._result);
+      _result_row = std::move(rhs._result_row);
+      _end = std::move(rhs._end);
+      _end_row = std::move(rhs._end_row);
+      _rebind_lazy_fields();
+      return *this;
+    }
 
     // Iterator
     class iterator
@@ -186,5 +202,24 @@ namespace sqlpp
       static_assert(detail::result_has_size<DbResult>::value, "Underlying connector does not support size()");
       return _result.size();
     }
+
+  private:
+    // Fields that have not been accessed yet refer to the result they are read from, see detail::lazy_results
+    void _rebind_lazy_fields()
+    {
+      _rebind_lazy_fields(detail::lazy_results_impl<db_result_t>{});
+    }
+
+    void _rebind_lazy_fields(const std::true_type& /*unused*/)
+    {
+      if (_result_row and detail::lazy_results(_result))
+      {
+        _result_row._bind(_result);
+      }
+    }
+
+    void _rebind_lazy_fields(const std::false_type& /*unused*/)
+    {
+    }
   };
 }  // namespace sqlpp
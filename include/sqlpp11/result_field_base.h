@@ -31,12 +31,127 @@
 #include <sqlpp11/exception.h>
 #include <sqlpp11/result_field.h>
 #include <sqlpp11/type_traits.h>
+#include <sqlpp11/detail/void.h>
 #include <utility>
 
 namespace sqlpp
 {
+  namespace detail
+  {
+    // Connectors that can hand out text and blob results without copying them into the result fields provide
+    // bool _zero_copy_results() in their result types. The data has to stay valid until the next row is fetched.
+    template <typename Target, typename = void>
+    struct zero_copy_results_impl
+    {
+      static bool enabled(const Target&)
+      {
+        return false;
+      }
+    };
+
+    template <typename Target>
+    struct zero_copy_results_impl<Target, void_t<decltype(std::declval<const Target&>()._zero_copy_results())>>
+    {
+      static bool enabled(const Target& target)
+      {
+        return target._zero_copy_results();
+      }
+    };
+
+    template <typename Target>
+    bool zero_copy_results(const Target& target)
+    {
+      return zero_copy_results_impl<Target>::enabled(target);
+    }
+
+    // Connectors that can decode result fields on first access instead of with the row provide
+    // bool _lazy_results() in their result types. Fields then keep a pointer to the result until they are accessed.
+    template <typename Target, typename = void>
+    struct lazy_results_impl : std::false_type
+    {
+      static bool enabled(const Target&)
+      {
+        return false;
+      }
+    };
+
+    template <typename Target>
+    struct lazy_results_impl<Target, void_t<decltype(std::declval<const Target&>()._lazy_results())>>
+        : std::true_type
+    {
+      static bool enabled(const Target& target)
+      {
+        return target._lazy_results();
+      }
+    };
+
+    template <typename Target>
+    bool lazy_results(const Target& target)
+    {
+      return lazy_results_impl<Target>::enabled(target);
+    }
+
+    // Only the result fields of connections that declare `using _lazy_results_t = std::true_type;` carry the state for
+    // binding on first access. The fields of other connectors keep their size and are always bound with the row.
+    template <typename Db, typename = void>
+    struct has_lazy_results : std::false_type
+    {
+    };
+
+    template <typename Db>
+    struct has_lazy_results<Db, void_t<typename Db::_lazy_results_t>> : Db::_lazy_results_t
+    {
+    };
+
+    template <typename Field, bool HasLazyResults>
+    struct result_field_pending
+    {
+      void _load() const
+      {
+      }
+
+      void _clear_pending()
+      {
+      }
+    };
+
+    template <typename Field>
+    struct result_field_pending<Field, true>
+    {
+      using _bind_function_t = void (*)(Field&, void*);
+
+      // With lazy results, the row hands the field a function that binds it later, see result_row.h
+      void _bind_on_access(_bind_function_t bind, void* target)
+      {
+        _pending_bind = bind;
+        _pending_target = target;
+      }
+
+      void _load() const
+      {
+        if (_pending_bind)
+        {
+          const auto bind = _pending_bind;
+          _pending_bind = nullptr;
+          // Result rows are never const objects, they are handed out as const references only
+          bind(const_cast<Field&>(static_cast<const Field&>(*this)), _pending_target);
+        }
+      }
+
+      void _clear_pending()
+      {
+        _pending_bind = nullptr;
+      }
+
+      mutable _bind_function_t _pending_bind{nullptr};
+      void* _pending_target{nullptr};
+    };
+  }  // namespace detail
+
   template <typename Db, typename FieldSpec, typename StorageType = typename value_type_of<FieldSpec>::_cpp_value_type>
   struct result_field_base
+      : public detail::result_field_pending<result_field_base<Db, FieldSpec, StorageType>,
+                                            detail::has_lazy_results<Db>::value>
   {
     using _field_spec_t = FieldSpec;
     using _alias_t = typename FieldSpec::_alias_t;
@@ -50,10 +165,33 @@ namespace sqlpp
     using _nodes = detail::type_vector<>;
     using _can_be_null = column_spec_can_be_null_t<_field_spec_t>;
 
+    using _result_field_base_t = result_field_base;
+    using _has_lazy_results = detail::has_lazy_results<Db>;
+
     result_field_base() : _is_valid{false}, _is_null{true}, _value{}
     {
     }
 
+    // Copies read a pending value first, since they may outlive the current row of the result
+    result_field_base(const result_field_base& rhs) : result_field_base{}
+    {
+      *this = rhs;
+    }
+
+    result_field_base& operator=(const result_field_base& rhs)
+    {
+      rhs._load();
+      _is_valid = rhs._is_valid;
+      _is_null = rhs._is_null;
+      _value = rhs._value;
+      this->_clear_pending();
+      return *this;
+    }
+
+    // Moves keep a pending value, the result rebinds the fields of its row when it is moved, see result.h
+    result_field_base(result_field_base&&) = default;
+    result_field_base& operator=(result_field_base&&) = default;
+
     bool operator==(const _cpp_value_type& rhs) const
     {
       return value() == rhs;
@@ -74,6 +212,7 @@ namespace sqlpp
       _is_valid = false;
       _is_null = true;
       _value = {};
+      this->_clear_pending();
     }
 
     bool is_null() const
@@ -82,6 +221,7 @@ namespace sqlpp
       {
         throw exception("accessing is_null in non-existing row");
       }
+      this->_load();
       return _is_null;
     }
 
@@ -91,6 +231,7 @@ namespace sqlpp
       {
         throw exception("accessing value in non-existing row");
       }
+      this->_load();
 
       if (_is_null)
       {
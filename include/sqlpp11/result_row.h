@@ -30,6 +30,7 @@
 #include <utility>
 #include <sqlpp11/data_types/text.h>
 #include <sqlpp11/detail/index_sequence.h>
+#include <sqlpp11/detail/void.h>
 #include <sqlpp11/dynamic_select_column_list.h>
 #include <sqlpp11/field_spec.h>
 #include <sqlpp11/no_name.h>
@@ -42,10 +43,22 @@ namespace sqlpp
     template <typename Db, typename IndexSequence, typename... FieldSpecs>
     struct result_row_impl;
 
+    // Fields that can be bound on first access, see result_field_base
+    template <typename Field, typename = void>
+    struct is_lazy_bindable : std::false_type
+    {
+    };
+
+    template <typename Field>
+    struct is_lazy_bindable<Field, void_t<typename Field::_has_lazy_results>> : Field::_has_lazy_results
+    {
+    };
+
     template <typename Db, std::size_t index, typename FieldSpec>
     struct result_field : public member_t<FieldSpec, result_field_t<Db, FieldSpec>>
     {
       using _field = member_t<FieldSpec, result_field_t<Db, FieldSpec>>;
+      using _field_t = result_field_t<Db, FieldSpec>;
 
       result_field() = default;
 
@@ -62,9 +75,32 @@ namespace sqlpp
       template <typename Target>
       void _bind(Target& target)
       {
+        _bind(target, is_lazy_bindable<_field_t>{});
+      }
+
+      template <typename Target>
+      void _bind(Target& target, const std::true_type& /*unused*/)
+      {
+        if (lazy_results(target))
+        {
+          _field::operator()()._bind_on_access(&_bind_field<Target, typename _field_t::_result_field_base_t>, &target);
+          return;
+        }
         _field::operator()()._bind(target, index);
       }
 
+      template <typename Target>
+      void _bind(Target& target, const std::false_type& /*unused*/)
+      {
+        _field::operator()()._bind(target, index);
+      }
+
+      template <typename Target, typename Base>
+      static void _bind_field(Base& field, void* target)
+      {
+        static_cast<_field_t&>(field)._bind(*static_cast<Target*>(target), index);
+      }
+
       template <typename Target>
       void _post_bind(Target& target)
       {
@@ -71,6 +71,16 @@ namespace sqlpp
         return _handle == rhs._handle;
       }
 
+      bool _zero_copy_results() const
+      {
+        return _handle and _handle->zero_copy_results;
+      }
+
+      bool _lazy_results() const
+      {
+        return _handle and _handle->lazy_results;
+      }
+
       template <typename ResultRow>
       void next(ResultRow& result_row)
       {
@@ -0,0 +1,180 @@
+#pragma once
+
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <utility>
+
+#include <sqlpp11/sqlite3/connection.h>
+
+namespace sqlpp
+{
+  namespace sqlite3
+  {
+    struct bulk_writer_options
+    {
+      size_t rows_per_transaction{10000};  // rows committed together, 0 = a single transaction for all rows
+    };
+
+    struct bulk_writer_stats
+    {
+      size_t rows{0};
+      size_t transactions{0};
+      std::chrono::steady_clock::duration elapsed{};  // from the first write() to the last commit
+
+      double rows_per_second() const
+      {
+        const auto seconds = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed).count();
+        return seconds > 0 ? static_cast<double>(rows) / seconds : 0.0;
+      }
+    };
+
+    // Writes many rows through one prepared insert and commits them in transactions of
+    // rows_per_transaction rows, e.g.
+    //
+    //   auto writer = make_bulk_writer(db, insert_into(tab).set(tab.alpha = parameter(tab.alpha)));
+    //   for (...)
+    //   {
+    //     writer.params().alpha = ...;
+    //     writer.write();
+    //   }
+    //   writer.finish();
+    //
+    // If a transaction is already active on the connection when a transaction would be started, the rows become
+    // part of that transaction instead. Destroying the writer before calling finish() rolls back the rows written
+    // since the last commit.
+    template <typename PreparedInsert>
+    class bulk_writer_t
+    {
+      connection_base* _db;
+      PreparedInsert _prepared_insert;
+      bulk_writer_options _options;
+      bulk_writer_stats _stats;
+      bool _transaction_active{false};
+      size_t _rows_in_transaction{0};
+      std::chrono::steady_clock::time_point _start;
+
+    public:
+      bulk_writer_t(connection_base& db, PreparedInsert prepared_insert, bulk_writer_options options)
+          : _db(&db), _prepared_insert(std::move(prepared_insert)), _options(options)
+      {
+      }
+
+      bulk_writer_t(const bulk_writer_t&) = delete;
+      bulk_writer_t(bulk_writer_t&& rhs)
+          : _db(rhs._db),
+            _prepared_insert(std::move(rhs._prepared_insert)),
+            _options(rhs._options),
+            _stats(rhs._stats),
+            _transaction_active(rhs._transaction_active),
+            _rows_in_transaction(rhs._rows_in_transaction),
+            _start(rhs._start)
+      {
+        rhs._transaction_active = false;
+      }
+      bulk_writer_t& operator=(const bulk_writer_t&) = delete;
+      bulk_writer_t& operator=(bulk_writer_t&&) = delete;
+
+      ~bulk_writer_t()
+      {
+        if (_transaction_active)
+        {
+          try
+          {
+            _db->rollback_transaction(false);
+          }
+          catch (const std::exception& e)
+          {
+            _db->report_rollback_failure(std::string{"bulk writer rollback failed: "} + e.what());
+          }
+        }
+      }
+
+      //! parameters of the next row
+      auto params() -> decltype((_prepared_insert.params))
+      {
+        return _prepared_insert.params;
+      }
+
+      //! insert a row with the current parameters
+      void write()
+      {
+        if (_stats.rows == 0)
+        {
+          _start = std::chrono::steady_clock::now();
+        }
+        if (not _transaction_active and not _db->is_transaction_active())
+        {
+          _db->start_transaction();
+          _transaction_active = true;
+        }
+        (*_db)(_prepared_insert);
+        ++_stats.rows;
+        ++_rows_in_transaction;
+        if (_options.rows_per_transaction != 0 and _rows_in_transaction >= _options.rows_per_transaction)
+        {
+          commit();
+        }
+      }
+
+      //! commit the rows written so far
+      void finish()
+      {
+        commit();
+      }
+
+      const bulk_writer_stats& stats() const
+      {
+        return _stats;
+      }
+
+    private:
+      void commit()
+      {
+        if (_transaction_active)
+        {
+          // If the commit fails, the transaction is still open and rolled back by the destructor
+          _db->commit_transaction();
+          _transaction_active = false;
+          ++_stats.transactions;
+        }
+        _rows_in_transaction = 0;
+        if (_stats.rows != 0)
+        {
+          _stats.elapsed = std::chrono::steady_clock::now() - _start;
+        }
+      }
+    };
+
+    template <typename Insert>
+    auto make_bulk_writer(connection_base& db, const Insert& insert, bulk_writer_options options = {})
+        -> bulk_writer_t<decltype(db.prepare(insert))>
+    {
+      return {db, db.prepare(insert), options};
+    }
+  }  // namespace sqlite3
+}  // namespace sqlpp
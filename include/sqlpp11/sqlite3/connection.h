@@ -33,10 +33,11 @@
 #include <sqlite3.h>
 #endif
 #include <sqlpp11/connection.h>
-#include <sqlpp11/detail/float_safe_ostringstream.h>
+#include <sqlpp11/detail/serialization_buffer.h>
 #include <sqlpp11/exception.h>
 #include <sqlpp11/schema.h>
 #include <sqlpp11/serialize.h>
+#include <sqlpp11/static_sql.h>
 #include <sqlpp11/sqlite3/bind_result.h>
 #include <sqlpp11/sqlite3/connection_config.h>
 #include <sqlpp11/sqlite3/detail/connection_handle.h>
@@ -73,6 +74,8 @@ namespace sqlpp
           std::cerr << "Sqlite3 debug: Preparing: '" << statement << "'" << std::endl;
 
         detail::prepared_statement_handle_t result{nullptr, handle->config->debug};
+        result.zero_copy_results = handle->config->zero_copy_results;
+        result.lazy_results = handle->config->lazy_results;
 
         // ignore trailing spaces
         const auto end =
@@ -114,6 +117,26 @@ namespace sqlpp
                                    std::string(sqlite3_errmsg(handle->native_handle()))};
         }
       }
+
+      // Binds the literal values of a statement executed with parameterize_literals
+      struct literal_binder_t : public ::sqlpp::static_value_binder<prepared_statement_t>
+      {
+        literal_binder_t(prepared_statement_t& target) : static_value_binder{target, 0}
+        {
+        }
+
+        using static_value_binder::operator();
+
+        void operator()(const text_operand& t)
+        {
+          _target._bind_text_literal(_index++, t._t);
+        }
+
+        void operator()(const blob_operand& t)
+        {
+          _target._bind_blob_literal(_index++, t._t);
+        }
+      };
     }  // namespace detail
 
     // Forward declaration
@@ -121,19 +144,17 @@ namespace sqlpp
 
     struct context_t
     {
-      context_t(const connection_base& db) : _db{db}, _count{1}
-      {
-      }
+      context_t(const connection_base& db);
 
       template <typename T>
-      std::ostream& operator<<(T t)
+      sqlpp::detail::serialization_buffer& operator<<(T t)
       {
         return _os << t;
       }
 
       std::string escape(const std::string& arg) const;
 
-      std::string str() const
+      const std::string& str() const
       {
         return _os.str();
       }
@@ -149,16 +170,37 @@ namespace sqlpp
       }
 
       const connection_base& _db;
-      sqlpp::detail::float_safe_ostringstream _os;
-      size_t _count;
+      sqlpp::detail::serialization_buffer _os;
+      size_t _count{1};
     };
 
+    // Parameters are numbered, see static_sql.h
+    std::integral_constant<char, '?'> get_parameter_prefix(const context_t&);
+
+    std::true_type are_parameters_numbered(const context_t&);
+
     // Base connection class
     class SQLPP11_SQLITE3_EXPORT connection_base : public sqlpp::connection
     {
     private:
+      friend struct context_t;
+      // Reused by context_t for serializing statements
+      mutable std::string _serialization_buffer;
+
       bool _transaction_active{false};
 
+      // Transactions are started and finished often, so their statements are prepared only once per connection
+      void execute_transaction_statement(std::shared_ptr<detail::prepared_statement_handle_t>& prepared,
+                                         const std::string& statement)
+      {
+        if (not prepared)
+        {
+          prepared = std::make_shared<detail::prepared_statement_handle_t>(prepare_statement(_handle, statement));
+        }
+        sqlite3_reset(prepared->sqlite_statement);
+        execute_statement(_handle, *prepared);
+      }
+
       // direct execution
       bind_result_t select_impl(const std::string& statement)
       {
@@ -197,8 +239,42 @@ namespace sqlpp
       // prepared execution
       prepared_statement_t prepare_impl(const std::string& statement)
       {
-        return {std::unique_ptr<detail::prepared_statement_handle_t>{
-            new detail::prepared_statement_handle_t(prepare_statement(_handle, statement))}};
+        if (auto cached = _handle->statement_cache.get(statement))
+        {
+          return {std::move(cached)};
+        }
+        return {_handle->statement_cache.put(
+            statement, std::make_shared<detail::prepared_statement_handle_t>(prepare_statement(_handle, statement)))};
+      }
+
+      // Prepares a directly executed statement with its literal values bound as parameters, if configured (returns a
+      // statement without handle otherwise)
+      template <typename Statement>
+      prepared_statement_t prepare_literals(const Statement& s)
+      {
+        return prepare_literals(s, has_parameterizable_values_t<context_t, Statement>{});
+      }
+
+      template <typename Statement>
+      prepared_statement_t prepare_literals(const Statement& s, const std::true_type&)
+      {
+        if (not _handle->config->parameterize_literals)
+        {
+          return {};
+        }
+        context_t context{*this};
+        serialize_parameterized(s, context);
+        auto prepared = prepare_impl(context.str());
+        prepared._reset();
+        detail::literal_binder_t binder{prepared};
+        sql_shape_t<context_t, Statement>::visit_values(s, binder);
+        return prepared;
+      }
+
+      template <typename Statement>
+      prepared_statement_t prepare_literals(const Statement& /*unused*/, const std::false_type&)
+      {
+        return {};
       }
 
       bind_result_t run_prepared_select_impl(prepared_statement_t& prepared_statement)
@@ -245,6 +321,8 @@ namespace sqlpp
       using _context_t = context_t;
       using _serializer_context_t = _context_t;
       using _interpreter_context_t = _context_t;
+      // Result fields can be bound on first access, see connection_config::lazy_results
+      using _lazy_results_t = std::true_type;
 
       struct _tags
       {
@@ -267,17 +345,20 @@ namespace sqlpp
       template <typename Select>
       bind_result_t select(const Select& s)
       {
+        auto prepared = prepare_literals(s);
+        if (prepared._handle)
+        {
+          return run_prepared_select_impl(prepared);
+        }
         _context_t context{*this};
-        serialize(s, context);
-        return select_impl(context.str());
+        return select_impl(serialize_statement(s, context));
       }
 
       template <typename Select>
       _prepared_statement_t prepare_select(Select& s)
       {
         _context_t context{*this};
-        serialize(s, context);
-        return prepare_impl(context.str());
+        return prepare_impl(serialize_statement(s, context));
       }
 
       template <typename PreparedSelect>
@@ -292,17 +373,20 @@ namespace sqlpp
       template <typename Insert>
       size_t insert(const Insert& i)
       {
+        auto prepared = prepare_literals(i);
+        if (prepared._handle)
+        {
+          return run_prepared_insert_impl(prepared);
+        }
         _context_t context{*this};
-        serialize(i, context);
-        return insert_impl(context.str());
+        return insert_impl(serialize_statement(i, context));
       }
 
       template <typename Insert>
       _prepared_statement_t prepare_insert(Insert& i)
       {
         _context_t context{*this};
-        serialize(i, context);
-        return prepare_impl(context.str());
+        return prepare_impl(serialize_statement(i, context));
       }
 
       template <typename PreparedInsert>
@@ -317,17 +401,20 @@ namespace sqlpp
       template <typename Update>
       size_t update(const Update& u)
       {
+        auto prepared = prepare_literals(u);
+        if (prepared._handle)
+        {
+          return run_prepared_update_impl(prepared);
+        }
         _context_t context{*this};
-        serialize(u, context);
-        return update_impl(context.str());
+        return update_impl(serialize_statement(u, context));
       }
 
       template <typename Update>
       _prepared_statement_t prepare_update(Update& u)
       {
         _context_t context{*this};
-        serialize(u, context);
-        return prepare_impl(context.str());
+        return prepare_impl(serialize_statement(u, context));
       }
 
       template <typename PreparedUpdate>
@@ -342,17 +429,20 @@ namespace sqlpp
       template <typename Remove>
       size_t remove(const Remove& r)
       {
+        auto prepared = prepare_literals(r);
+        if (prepared._handle)
+        {
+          return run_prepared_remove_impl(prepared);
+        }
         _context_t context{*this};
-        serialize(r, context);
-        return remove_impl(context.str());
+        return remove_impl(serialize_statement(r, context));
       }
 
       template <typename Remove>
       _prepared_statement_t prepare_remove(Remove& r)
       {
         _context_t context{*this};
-        serialize(r, context);
-        return prepare_impl(context.str());
+        return prepare_impl(serialize_statement(r, context));
       }
 
       template <typename PreparedRemove>
@@ -372,36 +462,34 @@ namespace sqlpp
         return static_cast<size_t>(sqlite3_changes(native_handle()));
       }
 
-      template <
-          typename Execute,
-          typename std::enable_if<not std::is_convertible<Execute, std::string>::value 
-                                  and not sqlpp::is_prepared_statement_t<Execute>::value, int>::type = 0>
-      size_t execute(const Execute& x)
-      {
-        static_assert(not sqlpp::is_select_t<Execute>::value, "argument must not be a select statement - use operator() instead");
-
-        _context_t context{*this};
-        serialize(x, context);
-        return execute(context.str());
-      }
-
-      template <
-          typename Execute,
-          typename std::enable_if<sqlpp::is_prepared_statement_t<Execute>::value, int>::type = 0>
-      size_t execute(const Execute& x)
-      {
-        static_assert(not sqlpp::is_select_t<Execute>::value, "argument must not be a select statement - use operator() instead");
-
-        operator()(x);
-        return static_cast<size_t>(sqlite3_changes(native_handle()));
+      template <
+          typename Execute,
+          typename std::enable_if<not std::is_convertible<Execute, std::string>::value 
+                                  and not sqlpp::is_prepared_statement_t<Execute>::value, int>::type = 0>
+      size_t execute(const Execute& x)
+      {
+        static_assert(not sqlpp::is_select_t<Execute>::value, "argument must not be a select statement - use operator() instead");
+
+        _context_t context{*this};
+        return execute(serialize_statement(x, context));
+      }
+
+      template <
+          typename Execute,
+          typename std::enable_if<sqlpp::is_prepared_statement_t<Execute>::value, int>::type = 0>
+      size_t execute(const Execute& x)
+      {
+        static_assert(not sqlpp::is_select_t<Execute>::value, "argument must not be a select statement - use operator() instead");
+
+        operator()(x);
+        return static_cast<size_t>(sqlite3_changes(native_handle()));
       }
 
       template <typename Execute>
       _prepared_statement_t prepare_execute(Execute& x)
       {
         _context_t context{*this};
-        serialize(x, context);
-        return prepare_impl(context.str());
+        return prepare_impl(serialize_statement(x, context));
       }
 
       template <typename PreparedExecute>
@@ -435,6 +523,13 @@ namespace sqlpp
         return t._run(*this);
       }
 
+      // Statements that change when they are run, e.g. prepared batch inserts
+      template <typename T>
+      auto _run(T& t, ::sqlpp::consistent_t) -> decltype(t._run(*this))
+      {
+        return t._run(*this);
+      }
+
       template <typename Check, typename T>
       auto _run(const T& t, Check) -> Check;
 
@@ -444,6 +539,12 @@ namespace sqlpp
         return _run(t, sqlpp::run_check_t<_serializer_context_t, T>{});
       }
 
+      template <typename T>
+      auto operator()(T& t) -> decltype(this->_run(t, sqlpp::run_check_t<_serializer_context_t, T>{}))
+      {
+        return _run(t, sqlpp::run_check_t<_serializer_context_t, T>{});
+      }
+
       //! call prepare on the argument
       template <typename T>
       auto _prepare(const T& t, const std::true_type&) -> decltype(t._prepare(*this))
@@ -494,8 +595,7 @@ namespace sqlpp
           throw sqlpp::exception{"Sqlite3 error: Cannot have more than one open transaction per connection"};
         }
 
-        auto prepared = prepare_statement(_handle, "BEGIN");
-        execute_statement(_handle, prepared);
+        execute_transaction_statement(_handle->begin_statement, "BEGIN");
         _transaction_active = true;
       }
 
@@ -506,8 +606,7 @@ namespace sqlpp
         {
           throw sqlpp::exception{"Sqlite3 error: Cannot commit a finished or failed transaction"};
         }
-        auto prepared = prepare_statement(_handle, "COMMIT");
-        execute_statement(_handle, prepared);
+        execute_transaction_statement(_handle->commit_statement, "COMMIT");
         _transaction_active = false;
       }
 
@@ -523,8 +622,7 @@ namespace sqlpp
         {
           std::cerr << "Sqlite3 warning: Rolling back unfinished transaction" << std::endl;
         }
-        auto prepared = prepare_statement(_handle, "ROLLBACK");
-        execute_statement(_handle, prepared);
+        execute_transaction_statement(_handle->rollback_statement, "ROLLBACK");
         _transaction_active = false;
       }
 
@@ -540,6 +638,12 @@ namespace sqlpp
         return _transaction_active;
       }
 
+      //! hits and misses of prepare() in the statement cache, see connection_config::statement_cache_size
+      sqlpp::statement_cache_stats get_statement_cache_stats() const
+      {
+        return _handle->statement_cache.stats();
+      }
+
       //! get the last inserted id
       uint64_t last_insert_id() noexcept
       {
@@ -570,7 +674,11 @@ namespace sqlpp
       }
     };
 
-    // Method definition moved outside of class because it needs connection_base
+    // Method definitions moved outside of class because they need connection_base
+    inline context_t::context_t(const connection_base& db) : _db(db), _os(db._serialization_buffer)
+    {
+    }
+
     inline std::string context_t::escape(const std::string& arg) const
     {
       return _db.escape(arg);
@@ -26,6 +26,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cstdint>
 #include <string>
 #include <iostream>
 
@@ -35,6 +36,33 @@ namespace sqlpp
   {
     struct connection_config
     {
+      enum class journal_mode_t
+      {
+        unchanged,
+        delete_file,
+        truncate,
+        persist,
+        memory,
+        wal,
+        off
+      };
+
+      enum class synchronous_t
+      {
+        unchanged,
+        off,
+        normal,
+        full,
+        extra
+      };
+
+      enum class temp_store_t
+      {
+        unchanged,
+        file,
+        memory
+      };
+
       connection_config() : path_to_database{}, flags{0}, vfs{}, debug{false}, password{}
       {
       }
@@ -51,7 +79,12 @@ namespace sqlpp
       bool operator==(const connection_config& other) const
       {
         return (other.path_to_database == path_to_database && other.flags == flags && other.vfs == vfs &&
-                other.debug == debug && other.password==password);
+                other.debug == debug && other.password==password && other.statement_cache_size == statement_cache_size &&
+                other.zero_copy_results == zero_copy_results && other.lazy_results == lazy_results &&
+                other.parameterize_literals == parameterize_literals && other.journal_mode == journal_mode &&
+                other.synchronous == synchronous && other.busy_timeout == busy_timeout &&
+                other.mmap_size == mmap_size && other.cache_size == cache_size && other.temp_store == temp_store &&
+                other.page_size == page_size);
       }
 
       bool operator!=(const connection_config& other) const
@@ -65,6 +98,28 @@ namespace sqlpp
       std::string vfs;
       bool debug;
       std::string password;
+      // Number of prepared statements kept per connection for reuse by prepare(), 0 disables the cache
+      size_t statement_cache_size{0};
+      // Text and blob result fields point into the result instead of copying it (valid until the next row)
+      bool zero_copy_results{false};
+      // Result fields are read from the current row when they are first accessed instead of with the row
+      bool lazy_results{false};
+      // Directly executed statements bind their literal values as parameters and are prepared via the statement cache
+      bool parameterize_literals{false};
+
+      // Settings applied when the connection is opened, the defaults leave the sqlite3 settings unchanged
+      journal_mode_t journal_mode{journal_mode_t::unchanged};
+      synchronous_t synchronous{synchronous_t::unchanged};
+      // Milliseconds to wait for a locked database before failing with SQLITE_BUSY, 0 fails immediately
+      int busy_timeout{0};
+      // Maximum number of bytes of the database file to memory map, -1 keeps the default, 0 disables memory mapping
+      int64_t mmap_size{-1};
+      // Page cache size in pages if positive or in KiB if negative, 0 keeps the default
+      int64_t cache_size{0};
+      temp_store_t temp_store{temp_store_t::unchanged};
+      // Page size in bytes (a power of two between 512 and 65536), only effective before the database file is
+      // created, 0 keeps the default
+      int page_size{0};
     };
   }
 }
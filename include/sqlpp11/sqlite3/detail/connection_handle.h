@@ -32,6 +32,7 @@
 #else
 #include <sqlite3.h>
 #endif
+#include <sqlpp11/detail/statement_cache.h>
 
 #ifdef SQLPP_DYNAMIC_LOADING
 #include <sqlpp11/sqlite3/dynamic_libsqlite3.h>
@@ -47,14 +48,23 @@ namespace sqlpp
 
     namespace detail
     {
+      struct prepared_statement_handle_t;
+
       struct connection_handle
       {
         std::shared_ptr<const connection_config> config;
         std::unique_ptr<::sqlite3, int (*)(::sqlite3*)> sqlite;
+        // Prepared statements for reuse by prepare(), finalized before the database is closed
+        sqlpp::detail::statement_cache<prepared_statement_handle_t> statement_cache;
+        // BEGIN, COMMIT and ROLLBACK, prepared on first use
+        std::shared_ptr<prepared_statement_handle_t> begin_statement;
+        std::shared_ptr<prepared_statement_handle_t> commit_statement;
+        std::shared_ptr<prepared_statement_handle_t> rollback_statement;
 
         connection_handle(const std::shared_ptr<const connection_config>& conf) :
           config{conf},
-          sqlite{nullptr, sqlite3_close}
+          sqlite{nullptr, sqlite3_close},
+          statement_cache{conf->statement_cache_size}
         {
 #ifdef SQLPP_DYNAMIC_LOADING
           init_sqlite("");
@@ -84,6 +94,8 @@ namespace sqlpp
             }
           }
 #endif
+
+          apply_settings(*conf);
         }
 
         connection_handle(const connection_handle&) = delete;
@@ -113,6 +125,91 @@ namespace sqlpp
           }
           return true;
         }
+
+      private:
+        void execute_pragma(const std::string& pragma)
+        {
+          char* error = nullptr;
+          if (sqlite3_exec(native_handle(), ("PRAGMA " + pragma).c_str(), nullptr, nullptr, &error) != SQLITE_OK)
+          {
+            const std::string msg = error ? error : sqlite3_errmsg(native_handle());
+            sqlite3_free(error);
+            throw sqlpp::exception{"Sqlite3 error: Can't set PRAGMA " + pragma + ": " + msg};
+          }
+        }
+
+        // The page size has to be set before switching to WAL, and the busy timeout before anything that
+        // might have to wait for a lock held by another connection
+        void apply_settings(const connection_config& conf)
+        {
+          if (conf.busy_timeout > 0)
+          {
+            sqlite3_busy_timeout(native_handle(), conf.busy_timeout);
+          }
+          if (conf.page_size > 0)
+          {
+            execute_pragma("page_size = " + std::to_string(conf.page_size));
+          }
+          switch (conf.journal_mode)
+          {
+            case connection_config::journal_mode_t::unchanged:
+              break;
+            case connection_config::journal_mode_t::delete_file:
+              execute_pragma("journal_mode = DELETE");
+              break;
+            case connection_config::journal_mode_t::truncate:
+              execute_pragma("journal_mode = TRUNCATE");
+              break;
+            case connection_config::journal_mode_t::persist:
+              execute_pragma("journal_mode = PERSIST");
+              break;
+            case connection_config::journal_mode_t::memory:
+              execute_pragma("journal_mode = MEMORY");
+              break;
+            case connection_config::journal_mode_t::wal:
+              execute_pragma("journal_mode = WAL");
+              break;
+            case connection_config::journal_mode_t::off:
+              execute_pragma("journal_mode = OFF");
+              break;
+          }
+          switch (conf.synchronous)
+          {
+            case connection_config::synchronous_t::unchanged:
+              break;
+            case connection_config::synchronous_t::off:
+              execute_pragma("synchronous = OFF");
+              break;
+            case connection_config::synchronous_t::normal:
+              execute_pragma("synchronous = NORMAL");
+              break;
+            case connection_config::synchronous_t::full:
+              execute_pragma("synchronous = FULL");
+              break;
+            case connection_config::synchronous_t::extra:
+              execute_pragma("synchronous = EXTRA");
+              break;
+          }
+          if (conf.mmap_size >= 0)
+          {
+            execute_pragma("mmap_size = " + std::to_string(conf.mmap_size));
+          }
+          if (conf.cache_size != 0)
+          {
+            execute_pragma("cache_size = " + std::to_string(conf.cache_size));
+          }
+          switch (conf.temp_store)
+          {
+            case connection_config::temp_store_t::unchanged:
+              break;
+            case connection_config::temp_store_t::file:
+              execute_pragma("temp_store = FILE");
+              break;
+            case connection_config::temp_store_t::memory:
+              execute_pragma("temp_store = MEMORY");
+              break;
+          }
+        }
       };
     }  // namespace detail
   }  // namespace sqlite3
@@ -47,6 +47,8 @@ namespace sqlpp
       {
         sqlite3_stmt* sqlite_statement;
         bool debug;
+        bool zero_copy_results = false;
+        bool lazy_results = false;
 
         prepared_statement_handle_t(sqlite3_stmt* statement, bool debug_) : sqlite_statement{statement}, debug{debug_}
         {
@@ -55,7 +57,9 @@ namespace sqlpp
         prepared_statement_handle_t(const prepared_statement_handle_t&) = delete;
         prepared_statement_handle_t(prepared_statement_handle_t&& rhs) :
           sqlite_statement{rhs.sqlite_statement},
-          debug{rhs.debug}
+          debug{rhs.debug},
+          zero_copy_results{rhs.zero_copy_results},
+          lazy_results{rhs.lazy_results}
         {
           rhs.sqlite_statement = nullptr;
         }
@@ -68,6 +72,8 @@ namespace sqlpp
             rhs.sqlite_statement = nullptr;
           }
           debug = rhs.debug;
+          zero_copy_results = rhs.zero_copy_results;
+          lazy_results = rhs.lazy_results;
 
           return *this;
         }
@@ -84,6 +90,15 @@ namespace sqlpp
         {
           return !sqlite_statement;
         }
+
+        // Called by the statement cache when the statement is not used anymore
+        void recycle()
+        {
+          if (sqlite_statement)
+          {
+            sqlite3_reset(sqlite_statement);
+          }
+        }
       };
     }
   }  // namespace sqlite3
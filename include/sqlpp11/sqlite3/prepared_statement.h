@@ -37,6 +37,7 @@
 #include <date/date.h>
 
 #include <sqlpp11/chrono.h>
+#include <sqlpp11/detail/float_safe_ostringstream.h>
 #include <sqlpp11/exception.h>
 #include <sqlpp11/sqlite3/export.h>
 
@@ -73,6 +74,63 @@ namespace sqlpp
                                    " bind returned unexpected value: " + std::to_string(result)};
         }
       }
+
+      // Elements of list parameters, which are bound as JSON arrays
+      inline void append_json_element(std::string& json, bool value)
+      {
+        json += value ? '1' : '0';
+      }
+
+      inline void append_json_element(std::string& json, int64_t value)
+      {
+        json += std::to_string(value);
+      }
+
+      inline void append_json_element(std::string& json, uint64_t value)
+      {
+        json += std::to_string(static_cast<int64_t>(value));  // like _bind_unsigned_integral_parameter
+      }
+
+      inline void append_json_element(std::string& json, double value)
+      {
+        if (not std::isfinite(value))
+        {
+          throw sqlpp::exception{"Sqlite3 error: list parameters cannot contain NaN or Inf"};
+        }
+        sqlpp::detail::float_safe_ostringstream out;
+        out << value;
+        json += out.str();
+      }
+
+      inline void append_json_element(std::string& json, const std::string& value)
+      {
+        constexpr char hex_chars[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+        json += '"';
+        for (const auto c : value)
+        {
+          switch (c)
+          {
+            case '"':
+              json += "\\\"";
+              break;
+            case '\\':
+              json += "\\\\";
+              break;
+            default:
+              if (static_cast<unsigned char>(c) < 0x20)
+              {
+                json += "\\u00";
+                json += hex_chars[c >> 4];
+                json += hex_chars[c & 0x0F];
+              }
+              else
+              {
+                json += c;
+              }
+          }
+        }
+        json += '"';
+      }
     }  // namespace detail
 
     class SQLPP11_SQLITE3_EXPORT prepared_statement_t
@@ -191,6 +249,50 @@ namespace sqlpp
         detail::check_bind_result(result, "text");
       }
 
+      // Literal values are copied, since their statement might be gone before the results are read
+      void _bind_text_literal(size_t index, const std::string& value)
+      {
+        if (_handle->debug)
+          std::cerr << "Sqlite3 debug: binding text literal " << value << " at index: " << index << std::endl;
+
+        const auto result = sqlite3_bind_text(_handle->sqlite_statement, static_cast<int>(index + 1), value.data(),
+                                              static_cast<int>(value.size()), SQLITE_TRANSIENT);
+        detail::check_bind_result(result, "text");
+      }
+
+      void _bind_blob_literal(size_t index, const std::vector<uint8_t>& value)
+      {
+        if (_handle->debug)
+          std::cerr << "Sqlite3 debug: binding blob literal size of " << value.size() << " at index: " << index
+                    << std::endl;
+
+        const auto result = sqlite3_bind_blob(_handle->sqlite_statement, static_cast<int>(index + 1), value.data(),
+                                              static_cast<int>(value.size()), SQLITE_TRANSIENT);
+        detail::check_bind_result(result, "blob");
+      }
+
+      // The values are bound as JSON array, see serializer.h
+      template <typename Element>
+      void _bind_list_parameter(size_t index, const std::vector<Element>* values)
+      {
+        std::string json{"["};
+        for (const auto& value : *values)
+        {
+          if (json.size() > 1)
+          {
+            json += ',';
+          }
+          detail::append_json_element(json, value);
+        }
+        json += ']';
+        if (_handle->debug)
+          std::cerr << "Sqlite3 debug: binding list parameter " << json << " at index: " << index << std::endl;
+
+        const auto result = sqlite3_bind_text(_handle->sqlite_statement, static_cast<int>(index + 1), json.data(),
+                                              static_cast<int>(json.size()), SQLITE_TRANSIENT);
+        detail::check_bind_result(result, "list");
+      }
+
       void _bind_date_parameter(size_t index, const ::sqlpp::chrono::day_point* value, bool is_null)
       {
         if (_handle->debug)
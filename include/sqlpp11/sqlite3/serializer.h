@@ -37,6 +37,7 @@
 #include <sqlpp11/data_types/integral/operand.h>
 #include <sqlpp11/data_types/time_point/operand.h>
 #include <sqlpp11/data_types/unsigned_integral/operand.h>
+#include <sqlpp11/list_parameter.h>
 #include <sqlpp11/parameter.h>
 #include <sqlpp11/pre_join.h>
 #include <sqlpp11/some.h>
@@ -55,6 +56,29 @@ namespace sqlpp
     return context;
   }
 
+  // List parameters are bound as a JSON array
+  template <typename Operand, typename ValueType, typename NameType>
+  sqlite3::context_t& serialize(const in_t<Operand, list_parameter_t<ValueType, NameType>>& t,
+                                sqlite3::context_t& context)
+  {
+    serialize_operand(t._operand, context);
+    context << " IN(SELECT value FROM json_each(";
+    serialize(parameter_t<ValueType, NameType>{}, context);
+    context << "))";
+    return context;
+  }
+
+  template <typename Operand, typename ValueType, typename NameType>
+  sqlite3::context_t& serialize(const not_in_t<Operand, list_parameter_t<ValueType, NameType>>& t,
+                                sqlite3::context_t& context)
+  {
+    serialize_operand(t._operand, context);
+    context << " NOT IN(SELECT value FROM json_each(";
+    serialize(parameter_t<ValueType, NameType>{}, context);
+    context << "))";
+    return context;
+  }
+
   // disable some stuff that won't work with sqlite3
 #if SQLITE_VERSION_NUMBER < 3008003
   template <typename Database, typename... Expressions>
@@ -0,0 +1,1050 @@
+#pragma once
+
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <sqlpp11/insert.h>
+#include <sqlpp11/remove.h>
+#include <sqlpp11/select.h>
+#include <sqlpp11/update.h>
+
+#include <sqlpp11/assignment.h>
+#include <sqlpp11/char_sequence.h>
+#include <sqlpp11/column.h>
+#include <sqlpp11/data_types.h>
+#include <sqlpp11/default_value.h>
+#include <sqlpp11/expression.h>
+#include <sqlpp11/is_not_null.h>
+#include <sqlpp11/is_null.h>
+#include <sqlpp11/join.h>
+#include <sqlpp11/null.h>
+#include <sqlpp11/on.h>
+#include <sqlpp11/parameter.h>
+#include <sqlpp11/pre_join.h>
+#include <sqlpp11/simple_column.h>
+#include <sqlpp11/sort_order.h>
+#include <sqlpp11/table_alias.h>
+#include <sqlpp11/detail/index_sequence.h>
+
+namespace sqlpp
+{
+  // Parameters are serialized as the prefix, followed by their 1-based position if they are numbered. Connectors
+  // that serialize parameters differently declare overloads for their context, like for get_quote_left().
+  template <typename Context>
+  std::integral_constant<char, '?'> get_parameter_prefix(const Context&);
+
+  template <typename Context>
+  std::false_type are_parameters_numbered(const Context&);
+
+  // The SQL text of T, computed at compile time. Specializations mirror serialize() for the nodes whose text does not
+  // depend on runtime values, i.e. names, keywords, operators and parameters (but not dynamic parts). Runtime values
+  // (literals and sort orders) leave a slot in the text and are serialized when the statement is. Each provides the
+  // number of parameters and values it contains, its text, given the number of parameters that precede it, and
+  // visits its values in the order of their slots.
+  template <typename Context, typename T, typename Enable = void>
+  struct static_serializer_t
+  {
+    using _is_static = std::false_type;
+    static constexpr std::size_t _parameter_count = 0;
+    static constexpr std::size_t _value_count = 0;
+    template <std::size_t Index>
+    using _text_t = char_sequence<>;
+    template <typename Node, typename Visitor>
+    static void _visit_values(const Node& /*unused*/, Visitor& /*unused*/)
+    {
+    }
+  };
+
+  // The complete text is known at compile time
+  template <typename Context, typename T>
+  using has_static_sql_t = std::integral_constant<bool,
+                                                  static_serializer_t<Context, T>::_is_static::value and
+                                                      static_serializer_t<Context, T>::_value_count == 0>;
+
+  // The text is known at compile time, except for the values
+  template <typename Context, typename T>
+  using has_sql_shape_t = typename static_serializer_t<Context, T>::_is_static;
+
+  // The values can be bound as parameters instead (see serialize_parameterized())
+  template <typename Context, typename T>
+  using has_parameterizable_values_t =
+      std::integral_constant<bool,
+                             static_serializer_t<Context, T>::_is_static::value and
+                                 static_serializer_t<Context, T>::_value_count != 0 and
+                                 static_serializer_t<Context, T>::_parameter_count == 0>;
+
+  namespace detail
+  {
+    template <typename... Sequences>
+    struct static_concat;
+
+    template <>
+    struct static_concat<>
+    {
+      using type = char_sequence<>;
+    };
+
+    template <char... Cs>
+    struct static_concat<char_sequence<Cs...>>
+    {
+      using type = char_sequence<Cs...>;
+    };
+
+    template <char... Lhs, char... Rhs, typename... Rest>
+    struct static_concat<char_sequence<Lhs...>, char_sequence<Rhs...>, Rest...>
+        : static_concat<char_sequence<Lhs..., Rhs...>, Rest...>
+    {
+    };
+
+    constexpr std::size_t static_length(const char* s)
+    {
+      return *s ? 1 + static_length(s + 1) : 0;
+    }
+
+    // Literal::value is a constexpr C string (like the _name of operators)
+    template <typename Literal, typename Indexes = make_index_sequence<static_length(Literal::value)>>
+    struct static_literal_sequence;
+
+    template <typename Literal, std::size_t... Is>
+    struct static_literal_sequence<Literal, index_sequence<Is...>>
+    {
+      using type = char_sequence<Literal::value[Is]...>;
+    };
+
+    // Decimal digits of N > 0
+    template <std::size_t N, char... Cs>
+    struct static_number : static_number<N / 10, static_cast<char>('0' + N % 10), Cs...>
+    {
+    };
+
+    template <char... Cs>
+    struct static_number<0, Cs...>
+    {
+      using type = char_sequence<Cs...>;
+    };
+
+    // Marks the position of a value in the text
+    constexpr char static_value_slot = '\x01';
+
+    // Parts of the text of a node, with the same interface as static_serializer_t. Parts are visited with the node
+    // they belong to.
+    template <typename Sequence>
+    struct static_text_part
+    {
+      using _is_static = std::true_type;
+      static constexpr std::size_t _parameter_count = 0;
+      static constexpr std::size_t _value_count = 0;
+      template <std::size_t Index>
+      using _text_t = Sequence;
+      template <typename Node, typename Visitor>
+      static void _visit_values(const Node& /*unused*/, Visitor& /*unused*/)
+      {
+      }
+    };
+
+    template <typename Literal>
+    using static_literal_part = static_text_part<typename static_literal_sequence<Literal>::type>;
+
+    template <char... Cs>
+    using static_chars_part = static_text_part<char_sequence<Cs...>>;
+
+    template <typename Context, typename Name>
+    struct static_name_part : static_text_part<Name>
+    {
+    };
+
+    template <typename Context, char... Cs>
+    struct static_name_part<Context, char_sequence<'!', Cs...>>
+        : static_text_part<char_sequence<decltype(get_quote_left(std::declval<Context>()))::value,
+                                         Cs...,
+                                         decltype(get_quote_right(std::declval<Context>()))::value>>
+    {
+    };
+
+    struct static_value_part
+    {
+      using _is_static = std::true_type;
+      static constexpr std::size_t _parameter_count = 0;
+      static constexpr std::size_t _value_count = 1;
+      template <std::size_t Index>
+      using _text_t = char_sequence<static_value_slot>;
+      template <typename Value, typename Visitor>
+      static void _visit_values(const Value& value, Visitor& visitor)
+      {
+        visitor(value);
+      }
+    };
+
+    // A part for a member of the node, obtained via Getter::get(node)
+    template <typename Getter, typename Part>
+    struct static_child_part : Part
+    {
+      template <typename Node, typename Visitor>
+      static void _visit_values(const Node& node, Visitor& visitor)
+      {
+        Part::_visit_values(Getter::get(node), visitor);
+      }
+    };
+
+    template <typename... Parts>
+    struct static_compose;
+
+    template <>
+    struct static_compose<> : static_text_part<char_sequence<>>
+    {
+    };
+
+    template <typename First, typename... Rest>
+    struct static_compose<First, Rest...>
+    {
+      using _rest_t = static_compose<Rest...>;
+      using _is_static = std::integral_constant<bool, First::_is_static::value and _rest_t::_is_static::value>;
+      static constexpr std::size_t _parameter_count = First::_parameter_count + _rest_t::_parameter_count;
+      static constexpr std::size_t _value_count = First::_value_count + _rest_t::_value_count;
+      template <std::size_t Index>
+      using _text_t =
+          typename static_concat<typename First::template _text_t<Index>,
+                                 typename _rest_t::template _text_t<Index + First::_parameter_count>>::type;
+      template <typename Node, typename Visitor>
+      static void _visit_values(const Node& node, Visitor& visitor)
+      {
+        First::_visit_values(node, visitor);
+        _rest_t::_visit_values(node, visitor);
+      }
+    };
+
+    // Like serialize_operand()
+    template <typename Context, typename T>
+    using static_operand_part = typename std::conditional<
+        requires_parens_t<T>::value,
+        static_compose<static_chars_part<'('>, static_serializer_t<Context, T>, static_chars_part<')'>>,
+        static_serializer_t<Context, T>>::type;
+
+    // Like interpret_tuple()
+    template <typename Separator, typename... Parts>
+    struct static_join;
+
+    template <typename Separator>
+    struct static_join<Separator> : static_compose<>
+    {
+    };
+
+    template <typename Separator, typename Part>
+    struct static_join<Separator, Part> : static_compose<Part>
+    {
+    };
+
+    template <typename Separator, typename First, typename Second, typename... Rest>
+    struct static_join<Separator, First, Second, Rest...>
+        : static_compose<First, Separator, static_join<Separator, Second, Rest...>>
+    {
+    };
+
+    // Joins the parts for the elements of a tuple member of the node, obtained via Getter<I>::get(node)
+    template <template <std::size_t> class Getter, typename Separator, typename Indexes, typename... Parts>
+    struct static_tuple_join_impl;
+
+    template <template <std::size_t> class Getter, typename Separator, std::size_t... Is, typename... Parts>
+    struct static_tuple_join_impl<Getter, Separator, index_sequence<Is...>, Parts...>
+        : static_join<Separator, static_child_part<Getter<Is>, Parts>...>
+    {
+    };
+
+    template <template <std::size_t> class Getter, typename Separator, typename... Parts>
+    using static_tuple_join = static_tuple_join_impl<Getter, Separator, make_index_sequence<sizeof...(Parts)>, Parts...>;
+
+    template <typename Policy>
+    struct static_get_policy_data
+    {
+      template <typename Database, typename... Policies>
+      static auto get(const statement_t<Database, Policies...>& t) -> const typename Policy::_data_t&
+      {
+        using P = statement_policies_t<Database, Policies...>;
+        return static_cast<const typename Policy::template _base_t<P>&>(t)()._data;
+      }
+    };
+
+#define SQLPP_STATIC_MEMBER_GETTER(GETTER, MEMBER)                \
+  struct GETTER                                                   \
+  {                                                               \
+    template <typename T>                                         \
+    static auto get(const T& t) -> decltype((t.MEMBER))           \
+    {                                                             \
+      return t.MEMBER;                                            \
+    }                                                             \
+  };
+
+#define SQLPP_STATIC_TUPLE_GETTER(GETTER, MEMBER)                 \
+  template <std::size_t I>                                        \
+  struct GETTER                                                   \
+  {                                                               \
+    template <typename T>                                         \
+    static auto get(const T& t) -> decltype(std::get<I>(t.MEMBER)) \
+    {                                                             \
+      return std::get<I>(t.MEMBER);                               \
+    }                                                             \
+  };
+
+    SQLPP_STATIC_MEMBER_GETTER(static_get_expression, _expression)
+    SQLPP_STATIC_MEMBER_GETTER(static_get_lhs, _lhs)
+    SQLPP_STATIC_MEMBER_GETTER(static_get_on, _on)
+    SQLPP_STATIC_MEMBER_GETTER(static_get_operand, _operand)
+    SQLPP_STATIC_MEMBER_GETTER(static_get_pre_join, _pre_join)
+    SQLPP_STATIC_MEMBER_GETTER(static_get_rhs, _rhs)
+    SQLPP_STATIC_MEMBER_GETTER(static_get_sort_type, _sort_type)
+    SQLPP_STATIC_MEMBER_GETTER(static_get_table, _table)
+    SQLPP_STATIC_MEMBER_GETTER(static_get_value, _value)
+
+    SQLPP_STATIC_TUPLE_GETTER(static_get_assignment, _assignments)
+    SQLPP_STATIC_TUPLE_GETTER(static_get_column, _columns)
+    SQLPP_STATIC_TUPLE_GETTER(static_get_element_expression, _expressions)
+    SQLPP_STATIC_TUPLE_GETTER(static_get_flag, _flags)
+    SQLPP_STATIC_TUPLE_GETTER(static_get_insert_value, _values)
+
+#undef SQLPP_STATIC_MEMBER_GETTER
+#undef SQLPP_STATIC_TUPLE_GETTER
+
+    struct static_as_t { static constexpr const char* value = " AS "; };
+    struct static_all_t { static constexpr const char* value = "ALL"; };
+    struct static_default_t { static constexpr const char* value = "DEFAULT"; };
+    struct static_delete_t { static constexpr const char* value = "DELETE"; };
+    struct static_distinct_t { static constexpr const char* value = "DISTINCT"; };
+    struct static_from_t { static constexpr const char* value = " FROM "; };
+    struct static_group_by_t { static constexpr const char* value = " GROUP BY "; };
+    struct static_having_t { static constexpr const char* value = " HAVING "; };
+    struct static_insert_t { static constexpr const char* value = "INSERT"; };
+    struct static_into_t { static constexpr const char* value = " INTO "; };
+    struct static_is_not_null_t { static constexpr const char* value = " IS NOT NULL"; };
+    struct static_is_null_t { static constexpr const char* value = " IS NULL"; };
+    struct static_join_t { static constexpr const char* value = " JOIN "; };
+    struct static_limit_t { static constexpr const char* value = " LIMIT "; };
+    struct static_not_t { static constexpr const char* value = "NOT "; };
+    struct static_null_t { static constexpr const char* value = "NULL"; };
+    struct static_offset_t { static constexpr const char* value = " OFFSET "; };
+    struct static_on_t { static constexpr const char* value = " ON "; };
+    struct static_order_by_t { static constexpr const char* value = " ORDER BY "; };
+    struct static_select_t { static constexpr const char* value = "SELECT "; };
+    struct static_set_t { static constexpr const char* value = " SET "; };
+    struct static_update_t { static constexpr const char* value = "UPDATE "; };
+    struct static_values_t { static constexpr const char* value = " VALUES("; };
+    struct static_where_t { static constexpr const char* value = " WHERE "; };
+
+    template <typename O>
+    struct static_operator_name_t
+    {
+      static constexpr const char* value = O::_name;
+    };
+  }  // namespace detail
+
+  // Statements
+  template <typename Context, typename... Policies>
+  struct static_serializer_t<Context, statement_t<void, Policies...>>
+      : detail::static_compose<detail::static_child_part<detail::static_get_policy_data<Policies>,
+                                                         static_serializer_t<Context, typename Policies::_data_t>>...>
+  {
+  };
+
+  template <typename Context>
+  struct static_serializer_t<Context, no_data_t> : detail::static_compose<>
+  {
+  };
+
+  template <typename Context>
+  struct static_serializer_t<Context, select_name_t> : detail::static_literal_part<detail::static_select_t>
+  {
+  };
+
+  template <typename Context>
+  struct static_serializer_t<Context, insert_name_t> : detail::static_literal_part<detail::static_insert_t>
+  {
+  };
+
+  template <typename Context>
+  struct static_serializer_t<Context, update_name_t> : detail::static_literal_part<detail::static_update_t>
+  {
+  };
+
+  template <typename Context>
+  struct static_serializer_t<Context, remove_name_t> : detail::static_literal_part<detail::static_delete_t>
+  {
+  };
+
+  template <typename Context>
+  struct static_serializer_t<Context, all_t> : detail::static_literal_part<detail::static_all_t>
+  {
+  };
+
+  template <typename Context>
+  struct static_serializer_t<Context, distinct_t> : detail::static_literal_part<detail::static_distinct_t>
+  {
+  };
+
+  template <typename Context, typename... Flags>
+  struct static_serializer_t<Context, select_flag_list_data_t<void, Flags...>>
+      : detail::static_compose<detail::static_tuple_join<detail::static_get_flag,
+                                                         detail::static_chars_part<' '>,
+                                                         detail::static_operand_part<Context, Flags>...>,
+                               typename std::conditional<sizeof...(Flags) != 0,
+                                                         detail::static_chars_part<' '>,
+                                                         detail::static_chars_part<>>::type>
+  {
+  };
+
+  template <typename Context, typename... Columns>
+  struct static_serializer_t<Context, select_column_list_data_t<void, Columns...>>
+      : detail::static_tuple_join<detail::static_get_column,
+                                  detail::static_chars_part<','>,
+                                  detail::static_operand_part<Context, Columns>...>
+  {
+  };
+
+  template <typename Context, typename Table>
+  struct static_serializer_t<Context, from_data_t<void, Table>>
+      : detail::static_compose<detail::static_literal_part<detail::static_from_t>,
+                               detail::static_child_part<detail::static_get_table, static_serializer_t<Context, Table>>>
+  {
+  };
+
+  template <typename Context, typename Expression>
+  struct static_serializer_t<Context, where_data_t<void, Expression>>
+      : detail::static_compose<
+            detail::static_literal_part<detail::static_where_t>,
+            detail::static_child_part<detail::static_get_expression, static_serializer_t<Context, Expression>>>
+  {
+  };
+
+  template <typename Context>
+  struct static_serializer_t<Context, where_data_t<void, unconditional_t>> : detail::static_compose<>
+  {
+  };
+
+  template <typename Context, typename... Expressions>
+  struct static_serializer_t<Context, group_by_data_t<void, Expressions...>>
+      : detail::static_compose<detail::static_literal_part<detail::static_group_by_t>,
+                               detail::static_tuple_join<detail::static_get_element_expression,
+                                                         detail::static_chars_part<','>,
+                                                         detail::static_operand_part<Context, Expressions>...>>
+  {
+  };
+
+  template <typename Context, typename Expression>
+  struct static_serializer_t<Context, having_data_t<void, Expression>>
+      : detail::static_compose<
+            detail::static_literal_part<detail::static_having_t>,
+            detail::static_child_part<detail::static_get_expression, static_serializer_t<Context, Expression>>>
+  {
+  };
+
+  template <typename Context, typename... Expressions>
+  struct static_serializer_t<Context, order_by_data_t<void, Expressions...>>
+      : detail::static_compose<detail::static_literal_part<detail::static_order_by_t>,
+                               detail::static_tuple_join<detail::static_get_element_expression,
+                                                         detail::static_chars_part<','>,
+                                                         detail::static_operand_part<Context, Expressions>...>>
+  {
+  };
+
+  template <typename Context, typename Limit>
+  struct static_serializer_t<Context, limit_data_t<Limit>>
+      : detail::static_compose<
+            detail::static_literal_part<detail::static_limit_t>,
+            detail::static_child_part<detail::static_get_value, detail::static_operand_part<Context, Limit>>>
+  {
+  };
+
+  template <typename Context, typename Offset>
+  struct static_serializer_t<Context, offset_data_t<Offset>>
+      : detail::static_compose<
+            detail::static_literal_part<detail::static_offset_t>,
+            detail::static_child_part<detail::static_get_value, detail::static_operand_part<Context, Offset>>>
+  {
+  };
+
+  template <typename Context, typename Table>
+  struct static_serializer_t<Context, into_data_t<void, Table>>
+      : detail::static_compose<detail::static_literal_part<detail::static_into_t>,
+                               detail::static_child_part<detail::static_get_table, static_serializer_t<Context, Table>>>
+  {
+  };
+
+  // Without assignments, DEFAULT VALUES is serialized, which is not the same for all connectors
+  template <typename Context, typename... Assignments>
+  struct static_serializer_t<Context,
+                             insert_list_data_t<void, Assignments...>,
+                             typename std::enable_if<sizeof...(Assignments) != 0>::type>
+      : detail::static_compose<
+            detail::static_chars_part<' ', '('>,
+            detail::static_join<detail::static_chars_part<','>,
+                                detail::static_operand_part<Context, simple_column_t<lhs_t<Assignments>>>...>,
+            detail::static_chars_part<')'>,
+            detail::static_literal_part<detail::static_values_t>,
+            detail::static_tuple_join<detail::static_get_insert_value,
+                                      detail::static_chars_part<','>,
+                                      detail::static_operand_part<Context, rhs_t<Assignments>>...>,
+            detail::static_chars_part<')'>>
+  {
+  };
+
+  template <typename Context, typename Table>
+  struct static_serializer_t<Context, single_table_data_t<void, Table>>
+      : detail::static_child_part<detail::static_get_table, static_serializer_t<Context, Table>>
+  {
+  };
+
+  template <typename Context, typename... Assignments>
+  struct static_serializer_t<Context, update_list_data_t<void, Assignments...>>
+      : detail::static_compose<detail::static_literal_part<detail::static_set_t>,
+                               detail::static_tuple_join<detail::static_get_assignment,
+                                                         detail::static_chars_part<','>,
+                                                         detail::static_operand_part<Context, Assignments>...>>
+  {
+  };
+
+  // Tables and joins
+  template <typename Context, typename Table>
+  struct static_serializer_t<Context, Table, typename std::enable_if<is_raw_table_t<Table>::value>::type>
+      : detail::static_name_part<Context, name_of<Table>>
+  {
+  };
+
+  template <typename Context, typename AliasProvider, typename Table, typename... ColumnSpecs>
+  struct static_serializer_t<Context, table_alias_t<AliasProvider, Table, ColumnSpecs...>>
+      : detail::static_compose<
+            detail::static_child_part<detail::static_get_table, detail::static_operand_part<Context, Table>>,
+            detail::static_literal_part<detail::static_as_t>,
+            detail::static_name_part<Context, name_of<table_alias_t<AliasProvider, Table, ColumnSpecs...>>>>
+  {
+  };
+
+  // Outer and right outer joins are not supported by all connectors
+  template <typename Context, typename JoinType, typename Lhs, typename Rhs>
+  struct static_serializer_t<Context,
+                             pre_join_t<JoinType, Lhs, Rhs>,
+                             typename std::enable_if<std::is_same<JoinType, inner_join_t>::value or
+                                                     std::is_same<JoinType, left_outer_join_t>::value or
+                                                     std::is_same<JoinType, cross_join_t>::value>::type>
+      : detail::static_compose<detail::static_child_part<detail::static_get_lhs, static_serializer_t<Context, Lhs>>,
+                               detail::static_literal_part<detail::static_operator_name_t<JoinType>>,
+                               detail::static_literal_part<detail::static_join_t>,
+                               detail::static_child_part<detail::static_get_rhs, static_serializer_t<Context, Rhs>>>
+  {
+  };
+
+  template <typename Context, typename PreJoin, typename On>
+  struct static_serializer_t<Context, join_t<PreJoin, On>>
+      : detail::static_compose<detail::static_child_part<detail::static_get_pre_join, static_serializer_t<Context, PreJoin>>,
+                               detail::static_child_part<detail::static_get_on, static_serializer_t<Context, On>>>
+  {
+  };
+
+  template <typename Context>
+  struct static_serializer_t<Context, on_t<unconditional_t>> : detail::static_compose<>
+  {
+  };
+
+  template <typename Context, typename Expression>
+  struct static_serializer_t<Context, on_t<Expression>>
+      : detail::static_compose<
+            detail::static_literal_part<detail::static_on_t>,
+            detail::static_child_part<detail::static_get_expression, static_serializer_t<Context, Expression>>>
+  {
+  };
+
+  // Columns
+  template <typename Context, typename Table, typename ColumnSpec>
+  struct static_serializer_t<Context, column_t<Table, ColumnSpec>>
+      : detail::static_compose<detail::static_name_part<Context, name_of<typename column_t<Table, ColumnSpec>::_table>>,
+                               detail::static_chars_part<'.'>,
+                               detail::static_name_part<Context, name_of<column_t<Table, ColumnSpec>>>>
+  {
+  };
+
+  template <typename Context, typename Column>
+  struct static_serializer_t<Context, simple_column_t<Column>>
+      : detail::static_name_part<Context, name_of<typename simple_column_t<Column>::_column_t>>
+  {
+  };
+
+  template <typename Context, typename Expression, typename AliasProvider>
+  struct static_serializer_t<Context, expression_alias_t<Expression, AliasProvider>>
+      : detail::static_compose<
+            detail::static_child_part<detail::static_get_expression, detail::static_operand_part<Context, Expression>>,
+            detail::static_literal_part<detail::static_as_t>,
+            detail::static_name_part<Context, name_of<expression_alias_t<Expression, AliasProvider>>>>
+  {
+  };
+
+  // Values and parameters
+  template <typename Context, typename T>
+  struct static_serializer_t<Context, T, typename std::enable_if<is_wrapped_value_t<T>::value>::type>
+      : detail::static_value_part
+  {
+  };
+
+  template <typename Context, typename ValueType, typename NameType>
+  struct static_serializer_t<Context, parameter_t<ValueType, NameType>> : detail::static_text_part<char_sequence<>>
+  {
+    static constexpr std::size_t _parameter_count = 1;
+    template <std::size_t Index>
+    using _text_t = typename std::conditional<
+        decltype(are_parameters_numbered(std::declval<Context>()))::value,
+        typename detail::static_concat<char_sequence<decltype(get_parameter_prefix(std::declval<Context>()))::value>,
+                                       typename detail::static_number<Index + 1>::type>::type,
+        char_sequence<decltype(get_parameter_prefix(std::declval<Context>()))::value>>::type;
+  };
+
+  template <typename Context>
+  struct static_serializer_t<Context, null_t> : detail::static_literal_part<detail::static_null_t>
+  {
+  };
+
+  template <typename Context>
+  struct static_serializer_t<Context, default_value_t> : detail::static_literal_part<detail::static_default_t>
+  {
+  };
+
+  // Expressions
+  template <typename Context, typename Lhs, typename Rhs>
+  struct static_serializer_t<Context, assignment_t<Lhs, Rhs>>
+      : detail::static_compose<static_serializer_t<Context, simple_column_t<Lhs>>,
+                               detail::static_chars_part<'='>,
+                               detail::static_child_part<detail::static_get_rhs, detail::static_operand_part<Context, Rhs>>>
+  {
+  };
+
+  template <typename Context, typename Lhs, typename Rhs>
+  struct static_serializer_t<Context, binary_expression_t<Lhs, op::equal_to, Rhs>>
+      : detail::static_compose<detail::static_chars_part<'('>,
+                               detail::static_child_part<detail::static_get_lhs, detail::static_operand_part<Context, Lhs>>,
+                               detail::static_chars_part<'='>,
+                               detail::static_child_part<detail::static_get_rhs, detail::static_operand_part<Context, Rhs>>,
+                               detail::static_chars_part<')'>>
+  {
+  };
+
+  template <typename Context, typename Lhs, typename Rhs>
+  struct static_serializer_t<Context, binary_expression_t<Lhs, op::not_equal_to, Rhs>>
+      : detail::static_compose<detail::static_chars_part<'('>,
+                               detail::static_child_part<detail::static_get_lhs, detail::static_operand_part<Context, Lhs>>,
+                               detail::static_chars_part<'<', '>'>,
+                               detail::static_child_part<detail::static_get_rhs, detail::static_operand_part<Context, Rhs>>,
+                               detail::static_chars_part<')'>>
+  {
+  };
+
+  template <typename Context, typename Lhs, typename O, typename Rhs>
+  struct static_serializer_t<Context, binary_expression_t<Lhs, O, Rhs>>
+      : detail::static_compose<detail::static_chars_part<'('>,
+                               detail::static_child_part<detail::static_get_lhs, detail::static_operand_part<Context, Lhs>>,
+                               detail::static_literal_part<detail::static_operator_name_t<O>>,
+                               detail::static_child_part<detail::static_get_rhs, detail::static_operand_part<Context, Rhs>>,
+                               detail::static_chars_part<')'>>
+  {
+  };
+
+  template <typename Context, typename Rhs>
+  struct static_serializer_t<Context, unary_expression_t<op::logical_not, Rhs>>
+      : detail::static_compose<detail::static_chars_part<'('>,
+                               detail::static_literal_part<detail::static_not_t>,
+                               detail::static_child_part<detail::static_get_rhs, detail::static_operand_part<Context, Rhs>>,
+                               detail::static_chars_part<')'>>
+  {
+  };
+
+  template <typename Context, typename O, typename Rhs>
+  struct static_serializer_t<Context, unary_expression_t<O, Rhs>>
+      : detail::static_compose<detail::static_chars_part<'('>,
+                               detail::static_literal_part<detail::static_operator_name_t<O>>,
+                               detail::static_child_part<detail::static_get_rhs, detail::static_operand_part<Context, Rhs>>,
+                               detail::static_chars_part<')'>>
+  {
+  };
+
+  template <typename Context, typename Operand>
+  struct static_serializer_t<Context, is_null_t<Operand>>
+      : detail::static_compose<
+            detail::static_child_part<detail::static_get_operand, detail::static_operand_part<Context, Operand>>,
+            detail::static_literal_part<detail::static_is_null_t>>
+  {
+  };
+
+  template <typename Context, typename Operand>
+  struct static_serializer_t<Context, is_not_null_t<Operand>>
+      : detail::static_compose<
+            detail::static_child_part<detail::static_get_operand, detail::static_operand_part<Context, Operand>>,
+            detail::static_literal_part<detail::static_is_not_null_t>>
+  {
+  };
+
+  // The direction of a sort order is a runtime value
+  template <typename Context, typename Expression>
+  struct static_serializer_t<Context, sort_order_t<Expression>>
+      : detail::static_compose<
+            detail::static_child_part<detail::static_get_expression, detail::static_operand_part<Context, Expression>>,
+            detail::static_child_part<detail::static_get_sort_type, detail::static_value_part>>
+  {
+  };
+
+  namespace detail
+  {
+    template <typename Sequence>
+    struct static_char_array;
+
+    template <char... Cs>
+    struct static_char_array<char_sequence<Cs...>>
+    {
+      static constexpr char value[sizeof...(Cs) + 1] = {Cs..., '\0'};
+    };
+
+    template <char... Cs>
+    constexpr char static_char_array<char_sequence<Cs...>>::value[sizeof...(Cs) + 1];
+
+    template <typename Context>
+    auto static_pop_count(Context& context, std::size_t count, int) -> decltype(context.pop_count(), void())
+    {
+      while (count--)
+      {
+        context.pop_count();
+      }
+    }
+
+    template <typename Context>
+    void static_pop_count(Context& /*unused*/, std::size_t /*unused*/, long)
+    {
+    }
+
+    template <typename T, typename Context>
+    void static_serialize_value(const T& t, Context& context)
+    {
+      serialize(t, context);
+    }
+
+    template <typename Context>
+    void static_serialize_value(const sort_type& t, Context& context)
+    {
+      context << (t == sort_type::asc ? " ASC" : " DESC");
+    }
+
+    // Serializes each value, followed by the text up to the next value
+    template <typename Context>
+    struct static_value_writer
+    {
+      Context& _context;
+      std::vector<std::string>::const_iterator _next_fragment;
+
+      template <typename T>
+      void operator()(const T& value)
+      {
+        static_serialize_value(value, _context);
+        _context << *_next_fragment;
+        ++_next_fragment;
+      }
+    };
+  }  // namespace detail
+
+  // The SQL text of a statement without dynamic parts, runtime values or connector specific clauses, as serialized
+  // with the given context.
+  template <typename Context, typename Statement>
+  struct static_sql_t
+  {
+    using _serializer_t = static_serializer_t<Context, Statement>;
+    static_assert(has_static_sql_t<Context, Statement>::value, "statement cannot be serialized at compile time");
+    using _array_t = detail::static_char_array<typename _serializer_t::template _text_t<0>>;
+
+    static constexpr std::size_t parameter_count = _serializer_t::_parameter_count;
+
+    static constexpr std::size_t size()
+    {
+      return sizeof(_array_t::value) - 1;
+    }
+
+    static constexpr const char* c_str()
+    {
+      return _array_t::value;
+    }
+
+    static const std::string& str()
+    {
+      static const std::string text(c_str(), size());
+      return text;
+    }
+  };
+
+  template <typename Context, typename Statement>
+  constexpr std::size_t static_sql_t<Context, Statement>::parameter_count;
+
+  // The SQL text of a statement without dynamic parts or connector specific clauses, split at its runtime values.
+  // The fragments are computed once per statement type.
+  template <typename Context, typename Statement>
+  struct sql_shape_t
+  {
+    using _serializer_t = static_serializer_t<Context, Statement>;
+    static_assert(has_sql_shape_t<Context, Statement>::value, "statement has no compile-time shape");
+    using _array_t = detail::static_char_array<typename _serializer_t::template _text_t<0>>;
+
+    static constexpr std::size_t parameter_count = _serializer_t::_parameter_count;
+    static constexpr std::size_t value_count = _serializer_t::_value_count;
+
+    // value_count + 1 fragments, the values go between them
+    static const std::vector<std::string>& fragments()
+    {
+      static const std::vector<std::string> result = split();
+      return result;
+    }
+
+    template <typename Visitor>
+    static void visit_values(const Statement& t, Visitor& visitor)
+    {
+      _serializer_t::_visit_values(t, visitor);
+    }
+
+  private:
+    static std::vector<std::string> split()
+    {
+      std::vector<std::string> result(1);
+      result.reserve(value_count + 1);
+      for (const char* c = _array_t::value; *c; ++c)
+      {
+        if (*c == detail::static_value_slot)
+        {
+          result.emplace_back();
+        }
+        else
+        {
+          result.back().push_back(*c);
+        }
+      }
+      return result;
+    }
+  };
+
+  template <typename Context, typename Statement>
+  constexpr std::size_t sql_shape_t<Context, Statement>::parameter_count;
+
+  template <typename Context, typename Statement>
+  constexpr std::size_t sql_shape_t<Context, Statement>::value_count;
+
+  // Used by connectors instead of serialize() for complete statements: Uses the compile-time text if available
+  // (counting its parameters like serialize() would), splices the values into the compile-time shape if there is
+  // one, and serializes into the context otherwise.
+  template <typename Statement, typename Context>
+  auto serialize_statement(const Statement& /*unused*/, Context& context) ->
+      typename std::enable_if<has_static_sql_t<Context, Statement>::value,
+                              decltype(std::declval<Context&>().str())>::type
+  {
+    detail::static_pop_count(context, static_sql_t<Context, Statement>::parameter_count, 0);
+    return static_sql_t<Context, Statement>::str();
+  }
+
+  template <typename Statement, typename Context>
+  auto serialize_statement(const Statement& t, Context& context) ->
+      typename std::enable_if<has_sql_shape_t<Context, Statement>::value and
+                                  not has_static_sql_t<Context, Statement>::value,
+                              decltype(std::declval<Context&>().str())>::type
+  {
+    using _shape_t = sql_shape_t<Context, Statement>;
+    const auto& fragments = _shape_t::fragments();
+    context << fragments.front();
+    detail::static_value_writer<Context> writer{context, fragments.begin() + 1};
+    _shape_t::visit_values(t, writer);
+    detail::static_pop_count(context, _shape_t::parameter_count, 0);
+    return context.str();
+  }
+
+  template <typename Statement, typename Context>
+  auto serialize_statement(const Statement& t, Context& context) ->
+      typename std::enable_if<not has_sql_shape_t<Context, Statement>::value,
+                              decltype(std::declval<Context&>().str())>::type
+  {
+    serialize(t, context);
+    return context.str();
+  }
+
+  namespace detail
+  {
+    // Connectors without unsigned parameters bind int64_t, so larger values stay in the text like they would without
+    // parameters
+    inline bool is_inline_unsigned(const unsigned_integral_operand& t)
+    {
+      return t._t > static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+    }
+
+    // Writes a parameter instead of each value (sort orders and large unsigned values are still written as text)
+    template <typename Context>
+    struct static_parameter_writer
+    {
+      Context& _context;
+      std::vector<std::string>::const_iterator _next_fragment;
+      std::size_t _parameter_count;
+
+      template <typename T>
+      void operator()(const T& /*unused*/)
+      {
+        _write_parameter();
+      }
+
+      void operator()(const unsigned_integral_operand& t)
+      {
+        if (is_inline_unsigned(t))
+        {
+          _write_inline(t);
+        }
+        else
+        {
+          _write_parameter();
+        }
+      }
+
+      void operator()(const sort_type& t)
+      {
+        _write_inline(t);
+      }
+
+      void _write_parameter()
+      {
+        _context << decltype(get_parameter_prefix(_context))::value;
+        ++_parameter_count;
+        if (decltype(are_parameters_numbered(_context))::value)
+        {
+          _context << _parameter_count;
+        }
+        _context << *_next_fragment;
+        ++_next_fragment;
+      }
+
+      template <typename T>
+      void _write_inline(const T& t)
+      {
+        static_serialize_value(t, _context);
+        _context << *_next_fragment;
+        ++_next_fragment;
+      }
+    };
+
+    template <typename Target>
+    auto static_bind_unsigned(Target& target, std::size_t index, const uint64_t& value, int)
+        -> decltype(target._bind_unsigned_integral_parameter(index, &value, false))
+    {
+      target._bind_unsigned_integral_parameter(index, &value, false);
+    }
+
+    template <typename Target>
+    void static_bind_unsigned(Target& target, std::size_t index, const uint64_t& value, long)
+    {
+      const auto signed_value = static_cast<int64_t>(value);
+      target._bind_integral_parameter(index, &signed_value, false);
+    }
+  }  // namespace detail
+
+  // Serializes a statement that has parameterizable values, with parameters in place of the values. Returns the
+  // number of parameters, which are then bound by visiting the values with a static_value_binder.
+  template <typename Statement, typename Context>
+  auto serialize_parameterized(const Statement& t, Context& context) ->
+      typename std::enable_if<has_parameterizable_values_t<Context, Statement>::value, std::size_t>::type
+  {
+    using _shape_t = sql_shape_t<Context, Statement>;
+    const auto& fragments = _shape_t::fragments();
+    context << fragments.front();
+    detail::static_parameter_writer<Context> writer{context, fragments.begin() + 1, 0};
+    _shape_t::visit_values(t, writer);
+    detail::static_pop_count(context, writer._parameter_count, 0);
+    return writer._parameter_count;
+  }
+
+  // Binds the values of a statement to the parameters written by serialize_parameterized(), using the same functions
+  // as parameter_value_t::_bind()
+  template <typename Target>
+  struct static_value_binder
+  {
+    Target& _target;
+    std::size_t _index;
+
+    void operator()(const boolean_operand& t)
+    {
+      const signed char value = t._t;
+      _target._bind_boolean_parameter(_index++, &value, false);
+    }
+
+    void operator()(const integral_operand& t)
+    {
+      _target._bind_integral_parameter(_index++, &t._t, false);
+    }
+
+    void operator()(const unsigned_integral_operand& t)
+    {
+      if (not detail::is_inline_unsigned(t))
+      {
+        detail::static_bind_unsigned(_target, _index++, t._t, 0);
+      }
+    }
+
+    void operator()(const floating_point_operand& t)
+    {
+      _target._bind_floating_point_parameter(_index++, &t._t, false);
+    }
+
+    void operator()(const text_operand& t)
+    {
+      _target._bind_text_parameter(_index++, &t._t, false);
+    }
+
+    void operator()(const blob_operand& t)
+    {
+      _target._bind_blob_parameter(_index++, &t._t, false);
+    }
+
+    void operator()(const day_point_operand& t)
+    {
+      _target._bind_date_parameter(_index++, &t._t, false);
+    }
+
+    template <typename Period>
+    void operator()(const time_point_operand<Period>& t)
+    {
+      const ::sqlpp::chrono::microsecond_point value =
+          std::chrono::time_point_cast<std::chrono::microseconds>(t._t);
+      _target._bind_date_time_parameter(_index++, &value, false);
+    }
+
+    template <typename Period>
+    void operator()(const time_of_day_operand<Period>& t)
+    {
+      const auto value = std::chrono::duration_cast<std::chrono::microseconds>(t._t);
+      _target._bind_time_of_day_parameter(_index++, &value, false);
+    }
+
+    void operator()(const sort_type& /*unused*/)
+    {
+    }
+  };
+}  // namespace sqlpp
@@ -52,6 +52,14 @@ int In(int, char* [])
   compare(__LINE__, foo.omega.in(sqlpp::value_list(std::vector<float>{1.75f, 2.5f, 17.f, 0.f})),
           "tab_foo.omega IN(1.75,2.5,17,0)");
 
+  // List parameters
+  compare(__LINE__, foo.omega.in(sqlpp::list_parameter(foo.omega)), "tab_foo.omega = ANY(?)");
+  compare(__LINE__, foo.omega.not_in(sqlpp::list_parameter(foo.omega)), "tab_foo.omega <> ALL(?)");
+  compare(__LINE__, (foo.omega + bar.alpha).in(sqlpp::list_parameter(foo.omega)),
+          "(tab_foo.omega+tab_bar.alpha) = ANY(?)");
+  compare(__LINE__, bar.gamma.is_null().not_in(sqlpp::list_parameter(bar.gamma)),
+          "(tab_bar.gamma IS NULL) <> ALL(?)");
+
   // Sub select
   compare(__LINE__, foo.omega.in(select(bar.alpha).from(bar).unconditionally()),
           "tab_foo.omega IN(SELECT tab_bar.alpha FROM tab_bar)");
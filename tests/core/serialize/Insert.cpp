@@ -49,6 +49,10 @@ int Insert(int, char* [])
           "INSERT INTO tab_bar (beta,gamma) VALUES('cheesecake'," + getTrue() + ")");
   compare(__LINE__, insert_into(bar).set(bar.beta = ::sqlpp::null, bar.gamma = true),
           "INSERT INTO tab_bar (beta,gamma) VALUES(NULL," + getTrue() + ")");
+  compare(__LINE__, insert_into(bar).columns(bar.beta, bar.gamma).batch(1),
+          "INSERT INTO tab_bar (beta,gamma) VALUES (?,?)");
+  compare(__LINE__, insert_into(bar).columns(bar.beta, bar.gamma).batch(3),
+          "INSERT INTO tab_bar (beta,gamma) VALUES (?,?),(?,?),(?,?)");
 #if SQLPP_CXX_STD >= 201703L
   // string_view argument
   std::string_view cheeseCake = "cheesecake";
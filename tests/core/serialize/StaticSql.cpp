@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2016-2016, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp11/compat/sqlpp_cxx_std.h>
+
+#include "compare.h"
+#include "Sample.h"
+#include <sqlpp11/sqlpp11.h>
+#include <sqlpp11/static_sql.h>
+
+#include <iostream>
+#include <limits>
+
+// A context that numbers its parameters like the sqlite3 and postgresql connectors do
+struct NumberingContext : MockDb::_serializer_context_t
+{
+  size_t count() const
+  {
+    return _count;
+  }
+
+  void pop_count()
+  {
+    ++_count;
+  }
+
+  size_t _count{1};
+};
+
+std::integral_constant<char, '$'> get_parameter_prefix(const NumberingContext&);
+std::true_type are_parameters_numbered(const NumberingContext&);
+
+namespace
+{
+  template <typename Statement>
+  void compare_static(int lineNo, const Statement& statement, const std::string& expected)
+  {
+    static_assert(sqlpp::has_static_sql_t<MockDb::_serializer_context_t, Statement>::value,
+                  "statement should be static");
+    using T = sqlpp::static_sql_t<MockDb::_serializer_context_t, Statement>;
+
+    assert_equal(lineNo, std::string(T::c_str()), expected);
+    compare(lineNo, statement, expected);
+
+    MockDb::_serializer_context_t printer = {};
+    assert_equal(lineNo, sqlpp::serialize_statement(statement, printer), expected);
+    assert_equal(lineNo, printer.str(), "");
+  }
+
+  template <typename Statement>
+  void compare_shape(int lineNo, const Statement& statement, const std::string& expected)
+  {
+    static_assert(sqlpp::has_sql_shape_t<MockDb::_serializer_context_t, Statement>::value,
+                  "statement should have a shape");
+    static_assert(not sqlpp::has_static_sql_t<MockDb::_serializer_context_t, Statement>::value,
+                  "statement should have values");
+
+    compare(lineNo, statement, expected);
+
+    MockDb::_serializer_context_t printer = {};
+    assert_equal(lineNo, sqlpp::serialize_statement(statement, printer), expected);
+  }
+}  // namespace
+
+int StaticSql(int, char*[])
+{
+  const auto foo = test::TabFoo{};
+  const auto bar = test::TabBar{};
+
+  // Select
+  compare_static(__LINE__, select(foo.omega).from(foo).unconditionally(), "SELECT tab_foo.omega FROM tab_foo");
+  compare_static(__LINE__, select(foo.omega, bar.alpha.as(foo.delta)).from(foo).where(foo.omega == bar.alpha),
+                 "SELECT tab_foo.omega,tab_bar.alpha AS delta FROM tab_foo WHERE (tab_foo.omega=tab_bar.alpha)");
+  compare_static(__LINE__,
+                 select(bar.beta)
+                     .flags(sqlpp::distinct)
+                     .from(bar)
+                     .where(bar.alpha > parameter(bar.alpha) and not bar.gamma)
+                     .group_by(bar.beta)
+                     .having(bar.delta.is_not_null()),
+                 "SELECT DISTINCT tab_bar.beta FROM tab_bar WHERE ((tab_bar.alpha>?) AND (NOT tab_bar.gamma)) GROUP "
+                 "BY tab_bar.beta HAVING tab_bar.delta IS NOT NULL");
+  compare_static(__LINE__,
+                 select(bar.alpha)
+                     .from(bar)
+                     .where(bar.beta != parameter(bar.beta) or bar.delta.is_null())
+                     .limit(parameter(sqlpp::unsigned_integral(), foo.delta))
+                     .offset(parameter(sqlpp::unsigned_integral(), foo.epsilon)),
+                 "SELECT tab_bar.alpha FROM tab_bar WHERE ((tab_bar.beta<>?) OR (tab_bar.delta IS NULL)) LIMIT ? "
+                 "OFFSET ?");
+
+  // Insert, update and remove
+  compare_static(__LINE__,
+                 insert_into(bar).set(bar.beta = parameter(bar.beta), bar.gamma = parameter(bar.gamma),
+                                      bar.delta = sqlpp::null),
+                 "INSERT INTO tab_bar (beta,gamma,delta) VALUES(?,?,NULL)");
+  compare_static(__LINE__, update(bar).set(bar.beta = parameter(bar.beta)).where(bar.alpha == parameter(bar.alpha)),
+                 "UPDATE tab_bar SET beta=? WHERE (tab_bar.alpha=?)");
+  compare_static(__LINE__, update(foo).set(foo.omega = foo.omega + parameter(foo.omega)).unconditionally(),
+                 "UPDATE tab_foo SET omega=(tab_foo.omega+?)");
+  compare_static(__LINE__, remove_from(foo).where(foo.delta == parameter(foo.delta)),
+                 "DELETE FROM tab_foo WHERE (tab_foo.delta=?)");
+
+  // Values are spliced into the shape of the statement
+  compare_shape(__LINE__, select(foo.omega).from(foo).where(foo.omega > 17),
+                "SELECT tab_foo.omega FROM tab_foo WHERE (tab_foo.omega>17)");
+  compare_shape(__LINE__, select(foo.omega).from(foo).where(foo.omega > 42.5),
+                "SELECT tab_foo.omega FROM tab_foo WHERE (tab_foo.omega>42.5)");
+  compare_shape(__LINE__, update(bar).set(bar.beta = "it's", bar.gamma = true).where(bar.alpha == 7),
+                "UPDATE tab_bar SET beta='it''s',gamma=1 WHERE (tab_bar.alpha=7)");
+  compare_shape(__LINE__, insert_into(bar).set(bar.beta = "cheese", bar.gamma = false, bar.delta = parameter(bar.delta)),
+                "INSERT INTO tab_bar (beta,gamma,delta) VALUES('cheese',0,?)");
+  compare_shape(__LINE__, select(foo.omega).from(foo).unconditionally().order_by(foo.omega.asc(), foo.delta.desc()),
+                "SELECT tab_foo.omega FROM tab_foo ORDER BY tab_foo.omega ASC,tab_foo.delta DESC");
+  {
+    const auto f = foo.as(sqlpp::alias::a);
+    compare_shape(__LINE__,
+                  select(f.omega, bar.beta)
+                      .from(f.join(bar).on(f.epsilon == bar.alpha).left_outer_join(foo).on(foo.delta == bar.beta))
+                      .where(bar.alpha > 3 and f.omega.is_not_null())
+                      .limit(10u),
+                  "SELECT a.omega,tab_bar.beta FROM tab_foo AS a INNER JOIN tab_bar ON (a.epsilon=tab_bar.alpha) LEFT "
+                  "OUTER JOIN tab_foo ON (tab_foo.delta=tab_bar.beta) WHERE ((tab_bar.alpha>3) AND (a.omega IS NOT "
+                  "NULL)) LIMIT 10");
+    compare_static(__LINE__, select(f.omega).from(f.cross_join(bar)).unconditionally(),
+                   "SELECT a.omega FROM tab_foo AS a CROSS JOIN tab_bar");
+  }
+  {
+    using Shape = sqlpp::sql_shape_t<MockDb::_serializer_context_t,
+                                     decltype(select(foo.omega).from(foo).where(foo.omega > 17 and foo.epsilon == 1))>;
+    static_assert(Shape::value_count == 2, "");
+    assert_equal(__LINE__, Shape::fragments().size(), 3u);
+    assert_equal(__LINE__, Shape::fragments().back(), "))");
+  }
+
+  // Dynamic parts are serialized at runtime
+  {
+    auto db = MockDb{};
+    auto s = dynamic_select(db, foo.omega).from(foo).unconditionally();
+    static_assert(not sqlpp::has_sql_shape_t<MockDb::_serializer_context_t, decltype(s)>::value, "");
+    MockDb::_serializer_context_t printer = {};
+    assert_equal(__LINE__, sqlpp::serialize_statement(s, printer), "SELECT tab_foo.omega FROM tab_foo");
+  }
+
+  // Numbered parameters
+  {
+    auto s = update(bar).set(bar.beta = parameter(bar.beta)).where(bar.alpha == parameter(bar.alpha));
+    static_assert(sqlpp::static_sql_t<NumberingContext, decltype(s)>::parameter_count == 2, "");
+    NumberingContext printer;
+    assert_equal(__LINE__, sqlpp::serialize_statement(s, printer), "UPDATE tab_bar SET beta=$1 WHERE (tab_bar.alpha=$2)");
+    assert_equal(__LINE__, printer.count(), 3u);
+  }
+  {
+    auto s = select(bar.alpha).from(bar).where(bar.beta == parameter(bar.beta) and bar.delta > 5 and
+                                                bar.alpha != parameter(bar.alpha));
+    NumberingContext printer;
+    assert_equal(__LINE__, sqlpp::serialize_statement(s, printer),
+                 "SELECT tab_bar.alpha FROM tab_bar WHERE (((tab_bar.beta=$1) AND (tab_bar.delta>5)) AND "
+                 "(tab_bar.alpha<>$2))");
+    assert_equal(__LINE__, printer.count(), 3u);
+  }
+
+  // Literal values as parameters, unsigned values beyond int64_t stay in the text
+  {
+    const auto huge = std::numeric_limits<uint64_t>::max();
+    auto s = select(foo.omega).from(foo).where(foo.epsilon > 17 and foo.psi != huge and foo.psi != 3u);
+    NumberingContext printer;
+    assert_equal(__LINE__, sqlpp::serialize_parameterized(s, printer), 2u);
+    assert_equal(__LINE__, printer.str(),
+                 "SELECT tab_foo.omega FROM tab_foo WHERE (((tab_foo.epsilon>$1) AND "
+                 "(tab_foo.psi<>18446744073709551615)) AND (tab_foo.psi<>$2))");
+  }
+
+  return 0;
+}
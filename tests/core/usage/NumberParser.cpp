@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp11/detail/parse_number.h>
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+  template <typename T>
+  void require_parsed(int line, bool (*parse)(T&, const char*, const char*), const char* text, T expected)
+  {
+    auto value = T{};
+    if (not parse(value, text, text + std::strlen(text)) or value != expected)
+    {
+      std::cerr << line << ": could not parse '" << text << "', got " << value << ", expected " << expected << std::endl;
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+
+  template <typename T>
+  void require_rejected(int line, bool (*parse)(T&, const char*, const char*), const char* text)
+  {
+    auto value = T{};
+    if (parse(value, text, text + std::strlen(text)))
+    {
+      std::cerr << line << ": unexpectedly parsed '" << text << "' as " << value << std::endl;
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+
+  void test_integral()
+  {
+    using sqlpp::detail::parse_int64;
+    require_parsed<int64_t>(__LINE__, parse_int64, "0", 0);
+    require_parsed<int64_t>(__LINE__, parse_int64, "17", 17);
+    require_parsed<int64_t>(__LINE__, parse_int64, "+17", 17);
+    require_parsed<int64_t>(__LINE__, parse_int64, "-17", -17);
+    require_parsed<int64_t>(__LINE__, parse_int64, "9223372036854775807", std::numeric_limits<int64_t>::max());
+    require_parsed<int64_t>(__LINE__, parse_int64, "-9223372036854775808", std::numeric_limits<int64_t>::min());
+    // Parsing stops at the first character that does not belong to the number
+    require_parsed<int64_t>(__LINE__, parse_int64, "12.75", 12);
+    require_rejected<int64_t>(__LINE__, parse_int64, "");
+    require_rejected<int64_t>(__LINE__, parse_int64, "-");
+    require_rejected<int64_t>(__LINE__, parse_int64, "abc");
+    require_rejected<int64_t>(__LINE__, parse_int64, "9223372036854775808");
+    require_rejected<int64_t>(__LINE__, parse_int64, "-9223372036854775809");
+
+    using sqlpp::detail::parse_uint64;
+    require_parsed<uint64_t>(__LINE__, parse_uint64, "18446744073709551615", std::numeric_limits<uint64_t>::max());
+    require_rejected<uint64_t>(__LINE__, parse_uint64, "18446744073709551616");
+  }
+
+  void test_floating_point(bool (*parse_double)(double&, const char*, const char*))
+  {
+    require_parsed<double>(__LINE__, parse_double, "0", 0.0);
+    require_parsed<double>(__LINE__, parse_double, "-0.5", -0.5);
+    require_parsed<double>(__LINE__, parse_double, "+0.5", 0.5);
+    require_parsed<double>(__LINE__, parse_double, "42", 42.0);
+    require_parsed<double>(__LINE__, parse_double, "0.1", 0.1);
+    require_parsed<double>(__LINE__, parse_double, "3.14159265358979", 3.14159265358979);
+    require_parsed<double>(__LINE__, parse_double, "0.000123", 0.000123);
+    require_parsed<double>(__LINE__, parse_double, "1.5e10", 1.5e10);
+    require_parsed<double>(__LINE__, parse_double, "1.5E-10", 1.5e-10);
+    require_parsed<double>(__LINE__, parse_double, "1.7976931348623157e+308", std::numeric_limits<double>::max());
+    require_parsed<double>(__LINE__, parse_double, "2.2250738585072014e-308", std::numeric_limits<double>::min());
+    require_parsed<double>(__LINE__, parse_double, "0.30000000000000004", 0.30000000000000004);
+    require_parsed<double>(__LINE__, parse_double, "123456789012345678901234567890", 123456789012345678901234567890.0);
+    require_parsed<double>(__LINE__, parse_double, "Infinity", std::numeric_limits<double>::infinity());
+    require_parsed<double>(__LINE__, parse_double, "-Infinity", -std::numeric_limits<double>::infinity());
+    require_parsed<double>(__LINE__, parse_double, "2.5 apples", 2.5);
+    // Zeros with many digits, like PostgreSQL sends them for numeric(40,30)
+    require_parsed<double>(__LINE__, parse_double, "0.000000000000000000000000000000", 0.0);
+    require_parsed<double>(__LINE__, parse_double, "-0.000000000000000000000000000000", 0.0);
+    require_parsed<double>(__LINE__, parse_double, "0000000000000000000000000000000.0", 0.0);
+    require_parsed<double>(__LINE__, parse_double, "0e-400", 0.0);
+    require_parsed<double>(__LINE__, parse_double, "0.000000000000000000000000000001", 1e-30);
+    require_parsed<double>(__LINE__, parse_double, "1000000000000000000000000000000", 1e30);
+
+    auto value = 0.0;
+    const auto nan = std::string{"NaN"};
+    if (not parse_double(value, nan.data(), nan.data() + nan.size()) or not std::isnan(value))
+    {
+      throw std::runtime_error("Could not parse NaN");
+    }
+
+    require_rejected<double>(__LINE__, parse_double, "");
+    require_rejected<double>(__LINE__, parse_double, ".");
+    require_rejected<double>(__LINE__, parse_double, "x1");
+  }
+}  // namespace
+
+int NumberParser(int, char*[])
+{
+  test_integral();
+  test_floating_point(sqlpp::detail::parse_double);
+  // The fallback for builds without std::from_chars
+  test_floating_point(sqlpp::detail::parse_double_without_from_chars);
+  return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp11/chrono.h>
+#include <sqlpp11/detail/float_safe_ostringstream.h>
+#include <sqlpp11/detail/serialization_buffer.h>
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+  // The buffer has to produce the same text as the stream it replaces
+  template <typename T>
+  void require_same_text(int line, const T& value)
+  {
+    auto os = sqlpp::detail::float_safe_ostringstream{};
+    os << value;
+
+    auto owner = std::string{};
+    sqlpp::detail::serialization_buffer buffer{owner};
+    buffer << value;
+    if (buffer.str() != os.str())
+    {
+      std::cerr << line << ": got '" << buffer.str() << "', expected '" << os.str() << "'" << std::endl;
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+
+  void test_text()
+  {
+    require_same_text(__LINE__, "SELECT ");
+    require_same_text(__LINE__, std::string{"tab.alpha"});
+    require_same_text(__LINE__, ',');
+    require_same_text(__LINE__, true);
+    require_same_text(__LINE__, false);
+  }
+
+  void test_integral()
+  {
+    require_same_text(__LINE__, 0);
+    require_same_text(__LINE__, 17);
+    require_same_text(__LINE__, -17);
+    require_same_text(__LINE__, std::numeric_limits<int64_t>::max());
+    require_same_text(__LINE__, std::numeric_limits<int64_t>::min());
+    require_same_text(__LINE__, std::numeric_limits<uint64_t>::max());
+    require_same_text(__LINE__, std::numeric_limits<int16_t>::min());
+    require_same_text(__LINE__, size_t{42});
+  }
+
+  void test_floating_point()
+  {
+    require_same_text(__LINE__, 0.0);
+    require_same_text(__LINE__, -0.0);
+    require_same_text(__LINE__, 0.1);
+    require_same_text(__LINE__, 1.0 / 3);
+    require_same_text(__LINE__, 1e100);
+    require_same_text(__LINE__, -2.5e-300);
+    require_same_text(__LINE__, 123456789.0);
+    require_same_text(__LINE__, std::numeric_limits<double>::max());
+    require_same_text(__LINE__, std::numeric_limits<double>::infinity());
+    require_same_text(__LINE__, 0.1f);
+    require_same_text(__LINE__, 3.14159f);
+    require_same_text(__LINE__, 0.1L);
+  }
+
+  void test_other()
+  {
+    // Types without a fast path are formatted by a stream
+    const auto day = ::date::year_month_day{::date::year{2016} / 2 / 29};
+    require_same_text(__LINE__, day);
+    require_same_text(__LINE__, ::date::make_time(std::chrono::microseconds{47000123456}));
+  }
+
+  void test_reuse()
+  {
+    auto owner = std::string{};
+    {
+      sqlpp::detail::serialization_buffer buffer{owner};
+      buffer << "SELECT " << 1;
+      if (buffer.str() != "SELECT 1")
+        throw std::runtime_error("Unexpected text");
+    }
+    if (owner.capacity() == 0)
+      throw std::runtime_error("Buffer has not been handed back");
+    {
+      sqlpp::detail::serialization_buffer buffer{owner};
+      if (not buffer.str().empty())
+        throw std::runtime_error("Buffer has not been cleared");
+      // Nested buffers start empty
+      sqlpp::detail::serialization_buffer nested{owner};
+      nested << "SELECT " << 2;
+      buffer << "SELECT " << 3;
+      if (nested.str() != "SELECT 2" or buffer.str() != "SELECT 3")
+        throw std::runtime_error("Unexpected text");
+    }
+
+    // Huge buffers are not kept
+    {
+      sqlpp::detail::serialization_buffer buffer{owner};
+      buffer << std::string(sqlpp::detail::serialization_buffer::max_reused_capacity + 1, 'x');
+    }
+    if (owner.capacity() > sqlpp::detail::serialization_buffer::max_reused_capacity)
+      throw std::runtime_error("Huge buffer has been kept");
+  }
+}  // namespace
+
+int SerializationBuffer(int, char*[])
+{
+  test_text();
+  test_integral();
+  test_floating_point();
+  test_other();
+  test_reuse();
+  return 0;
+}
@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sqlpp11/compat/make_unique.h>
 
+#include <chrono>
 #include <random>
 #include <set>
 #include <thread>
@@ -260,6 +261,175 @@ namespace sqlpp
         }
       }
 
+      template <typename Pool>
+      void test_max_connections(typename Pool::_config_ptr_t config, bool test_mt)
+      {
+        std::clog << __func__ << '\n';
+        auto options = sqlpp::connection_pool_options{};
+        options.max_connections = 2;
+        auto pool = Pool{config, 5, options};
+        auto conn_1 = pool.get();
+        {
+          auto conn_2 = pool.get();
+          try
+          {
+            pool.get(std::chrono::milliseconds{10});
+            throw std::logic_error{"Pool handed out more than max_connections connections"};
+          }
+          catch (const sqlpp::connection_pool_timeout&)
+          {
+          }
+        }
+        auto stats = pool.statistics();
+        if (stats.created != 2 or stats.live != 2 or stats.idle != 1 or stats.timeouts != 1 or stats.waits != 1)
+        {
+          throw std::logic_error{"Unexpected connection pool statistics"};
+        }
+        // The released connection can be fetched again, no new connection is opened
+        auto conn_2 = pool.get(std::chrono::milliseconds{10});
+        if (pool.statistics().created != 2)
+        {
+          throw std::logic_error{"Pool opened a new connection although one was available"};
+        }
+
+        if (test_mt)
+        {
+          // A blocked caller is handed the connection as soon as it is released
+          const auto native = conn_2.native_handle();
+          auto waiter = std::thread{};
+          {
+            auto released = std::move(conn_2);
+            waiter = std::thread([&pool, native]() {
+              auto conn = pool.get(std::chrono::seconds{10});
+              if (conn.native_handle() != native)
+              {
+                std::cerr << "Waiter received an unexpected connection\n";
+                std::abort();
+              }
+            });
+            while (pool.statistics().waiters == 0)
+            {
+              std::this_thread::yield();
+            }
+          }
+          waiter.join();
+          if (pool.statistics().created != 2)
+          {
+            throw std::logic_error{"Pool opened a new connection instead of handing over a released one"};
+          }
+        }
+      }
+
+      template <typename Pool>
+      void test_sharded(typename Pool::_config_ptr_t config, bool test_mt)
+      {
+        std::clog << __func__ << '\n';
+        auto options = sqlpp::connection_pool_options{};
+        options.shards = 4;
+        auto pool = Pool{config, 5, options};
+        test_conn_move(pool);
+        test_single_connection(pool);
+        if (test_mt)
+        {
+          test_multithreaded(pool);
+        }
+      }
+
+      // Polls the pool until the condition is met, gives up after a few seconds
+      template <typename Pool, typename Condition>
+      void wait_for_pool(Pool& pool, Condition condition, const std::string& message)
+      {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (not condition(pool.statistics()))
+        {
+          if (std::chrono::steady_clock::now() > deadline)
+          {
+            throw std::logic_error{message};
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+      }
+
+      template <typename Pool>
+      void test_maintenance(typename Pool::_config_ptr_t config)
+      {
+        std::clog << __func__ << '\n';
+        {
+          // Pre-warm the pool
+          auto options = sqlpp::connection_pool_options{};
+          options.maintenance_interval = std::chrono::milliseconds{5};
+          options.min_idle = 3;
+          auto pool = Pool{config, 5, options};
+          wait_for_pool(pool, [](const connection_pool_statistics& s) { return s.idle == 3 and s.created == 3; },
+                        "Pool was not pre-warmed");
+          auto db = pool.get(connection_check::none);
+          wait_for_pool(pool, [](const connection_pool_statistics& s) { return s.idle == 3 and s.created == 4; },
+                        "Pool did not refill the idle connections");
+        }
+        {
+          // At max_connections, wait for connections that are being checked instead of opening new ones
+          auto options = sqlpp::connection_pool_options{};
+          options.maintenance_interval = std::chrono::milliseconds{1};
+          options.max_connections = 1;
+          auto pool = Pool{config, 5, options};
+          pool.get();
+          const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds{50};
+          while (std::chrono::steady_clock::now() < deadline)
+          {
+            auto db = pool.get();
+          }
+          if (pool.statistics().created != 1)
+          {
+            throw std::logic_error{"Pool opened a new connection while the idle one was checked"};
+          }
+        }
+        {
+          // Below max_connections, never wait for connections that are being checked
+          auto options = sqlpp::connection_pool_options{};
+          options.maintenance_interval = std::chrono::milliseconds{1};
+          auto pool = Pool{config, 5, options};
+          pool.get();
+          const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds{50};
+          while (std::chrono::steady_clock::now() < deadline)
+          {
+            auto db = pool.get();
+          }
+          if (pool.statistics().waits != 0)
+          {
+            throw std::logic_error{"Pool waited for a checked connection although it could open a new one"};
+          }
+        }
+        {
+          // Evict idle connections
+          auto options = sqlpp::connection_pool_options{};
+          options.maintenance_interval = std::chrono::milliseconds{5};
+          options.idle_timeout = std::chrono::milliseconds{20};
+          options.min_idle = 1;
+          auto pool = Pool{config, 5, options};
+          {
+            auto db_1 = pool.get();
+            auto db_2 = pool.get();
+          }
+          wait_for_pool(pool, [](const connection_pool_statistics& s) { return s.idle == 1 and s.destroyed == 1; },
+                        "Pool did not evict idle connections");
+        }
+        {
+          // Recycle old connections
+          auto options = sqlpp::connection_pool_options{};
+          options.max_lifetime = std::chrono::milliseconds{20};
+          auto pool = Pool{config, 5, options};
+          {
+            auto db = pool.get();
+            std::this_thread::sleep_for(std::chrono::milliseconds{25});
+          }
+          const auto stats = pool.statistics();
+          if (stats.idle != 0 or stats.live != 0 or stats.destroyed != 1)
+          {
+            throw std::logic_error{"Pool did not close a connection that exceeded its lifetime"};
+          }
+        }
+      }
+
       template <typename Pool>
       void test_destruction_order(typename Pool::_config_ptr_t config)
       {
@@ -271,6 +441,41 @@ namespace sqlpp
       }
     }
 
+    // Measures the throughput of get() and the return of the connection with thread_count threads
+    template <typename Pool>
+    void benchmark_connection_pool(typename Pool::_config_ptr_t config,
+                                   const sqlpp::connection_pool_options& options,
+                                   std::size_t thread_count,
+                                   std::size_t iterations)
+    {
+      auto pool = Pool{config, thread_count, options};
+      auto threads = std::vector<std::thread>{};
+      const auto start = std::chrono::steady_clock::now();
+      for (std::size_t i = 0; i < thread_count; ++i)
+      {
+        threads.push_back(std::thread([&pool, iterations]() {
+          for (std::size_t k = 0; k < iterations; ++k)
+          {
+            auto db = pool.get(connection_check::none);
+          }
+        }));
+      }
+      for (auto&& t : threads)
+      {
+        t.join();
+      }
+      const auto elapsed = std::chrono::steady_clock::now() - start;
+      const auto stats = pool.statistics();
+      if (stats.created > thread_count or stats.idle != stats.created)
+      {
+        throw std::logic_error{"Connection pool lost track of its connections"};
+      }
+      std::clog << "shards: " << options.shards << ", threads: " << thread_count << ", acquire/release: "
+                << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() /
+                       static_cast<long long>(thread_count * iterations)
+                << " ns, connections: " << stats.created << '\n';
+    }
+
     template <typename Pool>
     void test_connection_pool (typename Pool::_config_ptr_t config, const std::string& create_table, bool test_mt)
     {
@@ -284,6 +489,12 @@ namespace sqlpp
       {
         test_multithreaded(pool);
       }
+      test_max_connections<Pool>(config, test_mt);
+      test_sharded<Pool>(config, test_mt);
+      if (test_mt)
+      {
+        test_maintenance<Pool>(config);
+      }
       test_destruction_order<Pool>(config);
     }
   }  // namespace test
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "make_test_connection.h"
+#include "TabSample.h"
+#include <cassert>
+#include <sqlpp11/insert.h>
+#include <sqlpp11/mysql/connection.h>
+#include <sqlpp11/remove.h>
+#include <sqlpp11/select.h>
+#include <sqlpp11/update.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+const auto library_raii = sqlpp::mysql::scoped_library_initializer_t{0, nullptr, nullptr};
+
+namespace sql = sqlpp::mysql;
+const auto tab = TabSample{};
+
+int Bulk(int, char*[])
+{
+  sql::global_library_init();
+  try
+  {
+    auto db = sql::make_test_connection();
+    db.execute(R"(DROP TABLE IF EXISTS tab_sample)");
+    db.execute(R"(CREATE TABLE tab_sample (
+		alpha bigint(20) AUTO_INCREMENT,
+			beta varchar(255) DEFAULT NULL,
+			gamma bool DEFAULT NULL,
+			PRIMARY KEY (alpha)
+			))");
+
+    auto prepared_insert =
+        db.prepare(insert_into(tab).set(tab.beta = parameter(tab.beta), tab.gamma = parameter(tab.gamma)));
+    auto rows = std::vector<decltype(prepared_insert.params)>(100);
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+      if (i % 10 == 0)
+        rows[i].beta.set_null();
+      else
+        rows[i].beta = "row " + std::to_string(i);
+      rows[i].gamma = i % 2 == 0;
+    }
+    auto result = db.run_bulk(prepared_insert, rows);
+    assert(result.affected_rows == rows.size());
+    assert(result.affected_rows_per_row.empty() or result.affected_rows_per_row.size() == rows.size());
+
+    size_t count = 0;
+    for (const auto& row : db(select(all_of(tab)).from(tab).order_by(tab.alpha.asc()).unconditionally()))
+    {
+      assert(row.beta.is_null() == (count % 10 == 0));
+      if (count % 10)
+        assert(row.beta.value() == "row " + std::to_string(count));
+      assert(row.gamma.value() == (count % 2 == 0));
+      ++count;
+    }
+    assert(count == rows.size());
+
+    // The prepared statement can still be used for single rows
+    prepared_insert.params.beta = "single";
+    prepared_insert.params.gamma = true;
+    db(prepared_insert);
+
+    auto prepared_update = db.prepare(update(tab).set(tab.gamma = parameter(tab.gamma)).where(tab.beta == parameter(tab.beta)));
+    auto updates = std::vector<decltype(prepared_update.params)>(3);
+    updates[0].beta = "row 1";
+    updates[1].beta = "row 3";
+    updates[2].beta = "no such row";
+    for (auto& u : updates)
+      u.gamma = true;
+    result = db.run_bulk(prepared_update, updates);
+    assert(result.affected_rows == 2);
+    if (not result.affected_rows_per_row.empty())
+    {
+      assert(result.affected_rows_per_row[0] == 1);
+      assert(result.affected_rows_per_row[2] == 0);
+    }
+
+    auto prepared_remove = db.prepare(remove_from(tab).where(tab.beta == parameter(tab.beta)));
+    auto removals = std::vector<decltype(prepared_remove.params)>(2);
+    removals[0].beta = "row 1";
+    removals[1].beta = "single";
+    assert(db.run_bulk(prepared_remove, removals).affected_rows == 2);
+
+    // Nothing to do
+    assert(db.run_bulk(prepared_remove, {}).affected_rows == 0);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
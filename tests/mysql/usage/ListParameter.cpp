@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "make_test_connection.h"
+#include "TabSample.h"
+#include <sqlpp11/insert.h>
+#include <sqlpp11/mysql/connection.h>
+#include <sqlpp11/select.h>
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+namespace sql = sqlpp::mysql;
+
+namespace
+{
+  const auto library_raii = sql::scoped_library_initializer_t{0, nullptr, nullptr};
+  const auto tab = TabSample{};
+}  // namespace
+
+int ListParameter(int, char*[])
+{
+  sql::global_library_init();
+  try
+  {
+    auto config = sql::make_test_config();
+    config->statement_cache_size = 10;
+    auto db = sql::connection{config};
+    db.execute(R"(DROP TABLE IF EXISTS tab_sample)");
+    db.execute(R"(CREATE TABLE tab_sample (
+			alpha bigint(20) AUTO_INCREMENT,
+			beta varchar(255) DEFAULT NULL,
+			gamma bool DEFAULT NULL,
+			PRIMARY KEY (alpha)
+			))");
+
+    const auto names = std::vector<std::string>{"plain", "it's", "\"quoted\"", "back\\slash", "tab\there", ""};
+    for (const auto& name : names)
+    {
+      db(insert_into(tab).set(tab.beta = name, tab.gamma = true));
+    }
+
+    // The list is padded to a power of two, lists of similar size share a native statement
+    auto by_alpha = db.prepare(select(tab.beta).from(tab).where(tab.alpha.in(sqlpp::list_parameter(tab.alpha)) and
+                                                               tab.gamma == parameter(tab.gamma)));
+    by_alpha.params.gamma = true;
+    for (size_t size = 0; size <= names.size(); ++size)
+    {
+      auto alphas = std::vector<int64_t>{};
+      for (size_t i = 0; i < size; ++i)
+      {
+        alphas.push_back(static_cast<int64_t>(i + 1));
+      }
+      by_alpha.params.alpha = alphas;
+      auto count = size_t{0};
+      for (const auto& row : db(by_alpha))
+      {
+        assert(row.beta == names[count]);
+        ++count;
+      }
+      assert(count == size);
+    }
+    // Buckets of 0, 1, 2, 4 and 8 placeholders
+    assert(db.get_statement_cache_stats().size == 5);
+
+    // Parameters after the list are bound to the right placeholders
+    by_alpha.params.alpha = std::vector<int64_t>{1, 2, 3};
+    by_alpha.params.gamma = false;
+    assert(db(by_alpha).empty());
+
+    // Text values are compared as they are
+    auto by_beta = db.prepare(select(tab.alpha).from(tab).where(tab.beta.in(sqlpp::list_parameter(tab.beta))));
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+      by_beta.params.beta = std::vector<std::string>{"unknown", names[i]};
+      auto result = db(by_beta);
+      assert(result.front().alpha.value() == static_cast<int64_t>(i + 1));
+      result.pop_front();
+      assert(result.empty());
+    }
+
+    auto excluded = db.prepare(select(tab.alpha).from(tab).where(tab.alpha.not_in(sqlpp::list_parameter(tab.alpha))));
+    excluded.params.alpha = std::vector<int>{1, 2, 3, 4, 5};
+    assert(db(excluded).front().alpha.value() == 6);
+    excluded.params.alpha = std::vector<int>{};
+    auto count = size_t{0};
+    for (const auto& row : db(excluded))
+    {
+      std::ignore = row;
+      ++count;
+    }
+    assert(count == names.size());
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
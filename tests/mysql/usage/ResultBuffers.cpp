@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "make_test_connection.h"
+#include "TabSample.h"
+#include <cassert>
+#include <sqlpp11/insert.h>
+#include <sqlpp11/mysql/connection.h>
+#include <sqlpp11/select.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+const auto library_raii = sqlpp::mysql::scoped_library_initializer_t{0, nullptr, nullptr};
+
+namespace sql = sqlpp::mysql;
+const auto tab = TabSample{};
+
+namespace
+{
+  void testResultBuffers(const std::shared_ptr<sql::connection_config>& config, const std::vector<std::string>& values)
+  {
+    sql::connection db{config};
+    auto prepared_select = db.prepare(sqlpp::select(tab.alpha, tab.beta).from(tab).order_by(tab.alpha.asc()).unconditionally());
+    // Run twice to reuse the statement's buffers with a fresh result
+    for (int run = 0; run < 2; ++run)
+    {
+      size_t index = 0;
+      for (const auto& row : db(prepared_select))
+      {
+        assert(index < values.size());
+        assert(row.beta.value() == values[index]);
+        ++index;
+      }
+      assert(index == values.size());
+    }
+  }
+}  // namespace
+
+int ResultBuffers(int, char*[])
+{
+  sql::global_library_init();
+  try
+  {
+    auto db = sql::make_test_connection();
+    db.execute(R"(DROP TABLE IF EXISTS tab_sample)");
+    db.execute(R"(CREATE TABLE tab_sample (
+		alpha bigint(20) AUTO_INCREMENT,
+			beta varchar(4000) DEFAULT NULL,
+			gamma bool DEFAULT NULL,
+			PRIMARY KEY (alpha)
+			))");
+
+    // Values that are shorter and longer than the initial buffer sizes, growing and shrinking
+    const auto values = std::vector<std::string>{"", "a", std::string(1500, 'b'), "cheese", std::string(3999, 'c'),
+                                                 std::string(20, 'd')};
+    for (const auto& value : values)
+    {
+      db(insert_into(tab).set(tab.beta = value, tab.gamma = true));
+    }
+
+    auto config = sql::make_test_config();
+    testResultBuffers(config, values);
+
+    config = sql::make_test_config();
+    config->store_results = true;
+    testResultBuffers(config, values);
+
+    config = sql::make_test_config();
+    config->prefetch_rows = 2;
+    testResultBuffers(config, values);
+
+    // A stored result leaves the connection free for other statements while the rows are read
+    config = sql::make_test_config();
+    config->store_results = true;
+    sql::connection stored_db{config};
+    auto prepared_select = stored_db.prepare(sqlpp::select(tab.beta).from(tab).unconditionally());
+    size_t count = 0;
+    for (const auto& row : stored_db(prepared_select))
+    {
+      stored_db(insert_into(tab).set(tab.beta = row.beta.value(), tab.gamma = false));
+      ++count;
+    }
+    assert(count == values.size());
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "make_test_connection.h"
+#include "TabSample.h"
+#include <cassert>
+#include <sqlpp11/insert.h>
+#include <sqlpp11/mysql/connection.h>
+#include <sqlpp11/select.h>
+
+#include <iostream>
+#include <memory>
+
+const auto library_raii = sqlpp::mysql::scoped_library_initializer_t{0, nullptr, nullptr};
+
+namespace sql = sqlpp::mysql;
+const auto tab = TabSample{};
+
+namespace
+{
+  void testSelect(sql::connection& db, int64_t expectedRowCount)
+  {
+    int64_t i = 0;
+    for (const auto& row : db(sqlpp::select(tab.alpha).from(tab).order_by(tab.alpha.asc()).unconditionally()))
+    {
+      ++i;
+      assert(i == row.alpha.value());
+    }
+    assert(i == expectedRowCount);
+  }
+
+  bool isRejected(sql::connection& db)
+  {
+    try
+    {
+      db(insert_into(tab).set(tab.gamma = false));
+    }
+    catch (const sqlpp::exception&)
+    {
+      return true;
+    }
+    return false;
+  }
+}  // namespace
+
+int ResultMode(int, char*[])
+{
+  sql::global_library_init();
+  try
+  {
+    auto db = sql::make_test_connection();
+    db.execute(R"(DROP TABLE IF EXISTS tab_sample)");
+    db.execute(R"(CREATE TABLE tab_sample (
+		alpha bigint(20) AUTO_INCREMENT,
+			beta varchar(255) DEFAULT NULL,
+			gamma bool DEFAULT NULL,
+			PRIMARY KEY (alpha)
+			))");
+
+    db.set_result_mode(sql::result_mode::streamed);
+    assert(db.get_result_mode() == sql::result_mode::streamed);
+
+    testSelect(db, 0);
+    for (int i = 0; i < 100; ++i)
+    {
+      db(insert_into(tab).set(tab.beta = "streamed", tab.gamma = true));
+    }
+    testSelect(db, 100);
+
+    {
+      // Other statements are rejected while a result is being streamed
+      auto result = db(sqlpp::select(tab.alpha).from(tab).unconditionally());
+      assert(not result.empty());
+      assert(isRejected(db));
+      // Destroying the partially read result discards the remaining rows
+    }
+    db(insert_into(tab).set(tab.gamma = false));
+    testSelect(db, 101);
+
+    {
+      // The connection can be used again as soon as the result has been read completely
+      auto result = db(sqlpp::select(tab.alpha).from(tab).unconditionally());
+      while (not result.empty())
+      {
+        result.pop_front();
+      }
+      assert(result.size() == 101);
+      assert(not isRejected(db));
+    }
+    testSelect(db, 102);
+
+    {
+      // A result that outlives its connection cannot read any more rows
+      auto other = std::unique_ptr<sql::connection>(new sql::connection(sql::make_test_config()));
+      other->set_result_mode(sql::result_mode::streamed);
+      auto result = (*other)(sqlpp::select(tab.alpha).from(tab).unconditionally());
+      assert(not result.empty());
+      other.reset();
+      try
+      {
+        result.pop_front();
+        assert(false);
+      }
+      catch (const sqlpp::exception&)
+      {
+      }
+    }
+
+    db.set_result_mode(sql::result_mode::buffered);
+    testSelect(db, 102);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include "TabFoo.h"
+#include "assertThrow.h"
+#include "make_test_connection.h"
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  model::TabFoo tab = {};
+
+  // An event loop would wait for the socket to become readable instead of spinning
+  void run_until_complete(sql::async_executor& executor)
+  {
+    assert(executor.socket() >= 0);
+    while (executor.pending())
+    {
+      executor.process();
+    }
+  }
+}  // namespace
+
+int Async(int, char*[])
+{
+  sql::connection db = sql::make_test_connection();
+
+  db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+  db.execute(R"(CREATE TABLE tabfoo
+             (
+               alpha bigint PRIMARY KEY,
+               beta smallint,
+               gamma text,
+               c_bool boolean,
+               c_timepoint timestamp with time zone,
+               c_day date
+             ))");
+
+  auto insert = db.prepare(insert_into(tab).set(tab.alpha = parameter(tab.alpha), tab.gamma = parameter(tab.gamma)));
+  {
+    sql::async_executor executor{db};
+
+    // Prepared statements are queued with their current parameters
+    std::vector<std::future<size_t>> inserted;
+    for (int i = 0; i < 10; ++i)
+    {
+      insert.params.alpha = i;
+      insert.params.gamma = "async";
+      inserted.push_back(executor.send(insert));
+    }
+    auto updated = executor.send(update(tab).set(tab.beta = 7).where(tab.alpha < 5));
+    auto selected = executor.send(select(tab.alpha, tab.beta).from(tab).where(tab.alpha >= 3).order_by(tab.alpha.asc()));
+
+    // Other statements are rejected while the executor exists
+    assert_throw(db(insert_into(tab).default_values()), sqlpp::exception);
+
+    run_until_complete(executor);
+    for (auto& future : inserted)
+    {
+      assert(future.get() == 1);
+    }
+    assert(updated.get() == 5);
+
+    // The result is the same as the one of db(select(...))
+    int64_t expected = 3;
+    for (const auto& row : selected.get())
+    {
+      assert(row.alpha == expected);
+      assert(row.beta.is_null() == (expected >= 5));
+      ++expected;
+    }
+    assert(expected == 10);
+
+    // Errors are reported to the callback, the next statement is executed nonetheless
+    auto failed = false;
+    auto count = int64_t{0};
+    insert.params.alpha = 1;
+    executor.send(insert, [&](std::exception_ptr error, size_t) {
+      try
+      {
+        std::rethrow_exception(error);
+      }
+      catch (const sql::unique_violation&)
+      {
+        failed = true;
+      }
+    });
+    executor.send(select(sqlpp::count(tab.alpha)).from(tab).unconditionally(),
+                  [&](std::exception_ptr error, sql::async_result_t<decltype(
+                                                     select(sqlpp::count(tab.alpha)).from(tab).unconditionally())> result) {
+                    assert(not error);
+                    count = result.front().count;
+                  });
+    executor.wait();
+    assert(failed);
+    assert(count == 10);
+
+    // Prepared selects work as well
+    auto prepared_select = db.prepare(select(tab.gamma).from(tab).where(tab.alpha == parameter(tab.alpha)));
+    prepared_select.params.alpha = 9;
+    auto gamma = executor.send(prepared_select);
+    run_until_complete(executor);
+    assert(gamma.get().front().gamma == "async");
+  }
+
+  // The connection can be used normally again
+  assert(db(select(sqlpp::count(tab.alpha)).from(tab).unconditionally()).front().count.value() == 10);
+
+  return 0;
+}
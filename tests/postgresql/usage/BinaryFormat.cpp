@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2013 - 2015, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <cassert>
+#include <iostream>
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include "BlobSample.h"
+#include "TabFoo.h"
+#include "make_test_connection.h"
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  model::TabFoo tab = {};
+  model::BlobSample blob = {};
+}  // namespace
+
+int BinaryFormat(int, char*[])
+{
+  auto config = sql::make_test_config();
+  config->binary_format = true;
+  sql::connection db(config);
+  db.execute("SET TIME ZONE UTC;");
+
+  db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+  db.execute(R"(CREATE TABLE tabfoo
+             (
+               alpha bigserial NOT NULL,
+               beta smallint,
+               gamma text,
+               c_bool boolean,
+               c_timepoint timestamp with time zone,
+               c_day date
+             ))");
+  db.execute(R"(DROP TABLE IF EXISTS blob_sample;)");
+  db.execute(R"(CREATE TABLE blob_sample (
+             id bigserial PRIMARY KEY,
+             data bytea
+           ))");
+
+  const auto day = sqlpp::chrono::day_point{::date::year{1999} / 12 / 31};
+  const auto timepoint = sqlpp::chrono::microsecond_point{day + std::chrono::hours{23} + std::chrono::microseconds{59123456}};
+
+  auto insert = db.prepare(insert_into(tab).set(tab.beta = parameter(tab.beta), tab.gamma = parameter(tab.gamma),
+                                                tab.c_bool = parameter(tab.c_bool),
+                                                tab.c_timepoint = parameter(tab.c_timepoint),
+                                                tab.c_day = parameter(tab.c_day)));
+  insert.params.beta = -17;
+  insert.params.gamma = "binary";
+  insert.params.c_bool = true;
+  insert.params.c_timepoint = timepoint;
+  insert.params.c_day = day;
+  db(insert);
+  insert.params.beta = sqlpp::null;
+  insert.params.gamma = sqlpp::null;
+  insert.params.c_bool = sqlpp::null;
+  insert.params.c_timepoint = sqlpp::null;
+  insert.params.c_day = sqlpp::null;
+  db(insert);
+  // Values that do not fit into the column are reported by the server, just like in text format
+  insert.params.beta = 100000;
+  try
+  {
+    db(insert);
+    assert(false);
+  }
+  catch (const sql::data_exception&)
+  {
+  }
+
+  auto select = db.prepare(
+      sqlpp::select(all_of(tab)).from(tab).where(tab.alpha > parameter(tab.alpha)).order_by(tab.alpha.asc()));
+  select.params.alpha = 0;
+  auto result = db(select);
+  {
+    const auto& row = result.front();
+    assert(row.alpha.value() == 1);
+    assert(row.beta.value() == -17);
+    assert(row.gamma.value() == "binary");
+    assert(row.c_bool.value() == true);
+    assert(row.c_timepoint.value() == timepoint);
+    assert(row.c_day.value() == day);
+  }
+  result.pop_front();
+  {
+    const auto& row = result.front();
+    assert(row.beta.is_null());
+    assert(row.gamma.is_null());
+    assert(row.c_bool.is_null());
+    assert(row.c_timepoint.is_null());
+    assert(row.c_day.is_null());
+  }
+
+  // Non-text columns read into text fields are rendered like in text format
+  for (const auto& row : db(db.prepare(
+           sqlpp::select(sqlpp::verbatim<sqlpp::text>("beta").as(tab.gamma), sqlpp::verbatim<sqlpp::text>("c_bool").as(tab.c_bool))
+               .from(tab)
+               .where(tab.alpha == 1))))
+  {
+    assert(row.gamma.value() == "-17");
+    assert(row.c_bool.value() == "t");
+  }
+
+  // Blobs are transferred without hex encoding
+  const auto data = std::vector<uint8_t>{0, 1, 2, 127, 128, 254, 255};
+  auto insert_blob = db.prepare(insert_into(blob).set(blob.data = parameter(blob.data)));
+  insert_blob.params.data = data;
+  db(insert_blob);
+  insert_blob.params.data = std::vector<uint8_t>{};
+  db(insert_blob);
+  auto select_blob = db.prepare(sqlpp::select(blob.data).from(blob).where(blob.id == parameter(blob.id)));
+  select_blob.params.id = 1;
+  assert(db(select_blob).front().data.value() == data);
+  select_blob.params.id = 2;
+  {
+    auto blob_result = db(select_blob);
+    assert(not blob_result.front().data.is_null());
+    assert(blob_result.front().data.value().empty());
+  }
+  // Direct execution still uses text format
+  assert(db(sqlpp::select(blob.data).from(blob).where(blob.id == 1)).front().data.value() == data);
+
+  return 0;
+}
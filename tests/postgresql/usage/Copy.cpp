@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2013 - 2015, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <cassert>
+#include <iostream>
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include "TabFoo.h"
+#include "assertThrow.h"
+#include "make_test_connection.h"
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  model::TabFoo tab = {};
+
+  const auto day = sqlpp::chrono::day_point{::date::year{2016} / 2 / 29};
+  const auto timepoint = sqlpp::chrono::microsecond_point{day + std::chrono::hours{13} + std::chrono::microseconds{17}};
+  const auto text = std::string{"tab\tnewline\nbackslash\\ carriage return\r"};
+
+  void recreate_table(sql::connection& db)
+  {
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+               (
+                 alpha bigint NOT NULL,
+                 beta smallint,
+                 gamma text,
+                 c_bool boolean,
+                 c_timepoint timestamp with time zone,
+                 c_day date
+               ))");
+  }
+
+  void test_copy(sql::connection& db, sql::copy_format format, int row_count)
+  {
+    recreate_table(db);
+    auto options = sql::copy_options{};
+    options.format = format;
+    options.buffer_size = 1024;  // send many buffers
+
+    auto copy = sql::copy_into(db, tab, options)
+                    .columns(tab.alpha, tab.beta, tab.gamma, tab.c_bool, tab.c_timepoint, tab.c_day);
+    for (int i = 0; i < row_count; ++i)
+    {
+      copy.add(tab.alpha = i, tab.beta = i % 100, tab.gamma = text, tab.c_bool = (i % 2 == 0),
+               tab.c_timepoint = timepoint, tab.c_day = day);
+    }
+    copy.add(tab.alpha = row_count, tab.beta = sqlpp::null, tab.gamma = sqlpp::null, tab.c_bool = sqlpp::null,
+             tab.c_timepoint = sqlpp::null, tab.c_day = sqlpp::null);
+    // The connection cannot be used for anything else while copying
+    assert_throw(db.execute("SELECT 1"), sqlpp::exception);
+    assert(copy.finish() == static_cast<size_t>(row_count + 1));
+    assert_throw(copy.finish(), sqlpp::exception);
+
+    int i = 0;
+    for (const auto& row : db(sqlpp::select(all_of(tab)).from(tab).unconditionally().order_by(tab.alpha.asc())))
+    {
+      assert(row.alpha.value() == i);
+      if (i < row_count)
+      {
+        assert(row.beta.value() == i % 100);
+        assert(row.gamma.value() == text);
+        assert(row.c_bool.value() == (i % 2 == 0));
+        assert(row.c_timepoint.value() == timepoint);
+        assert(row.c_day.value() == day);
+      }
+      else
+      {
+        assert(row.beta.is_null());
+        assert(row.gamma.is_null());
+        assert(row.c_bool.is_null());
+        assert(row.c_timepoint.is_null());
+        assert(row.c_day.is_null());
+      }
+      ++i;
+    }
+    assert(i == row_count + 1);
+  }
+}  // namespace
+
+int Copy(int, char*[])
+{
+  sql::connection db = sql::make_test_connection();
+
+  test_copy(db, sql::copy_format::text, 10000);
+  test_copy(db, sql::copy_format::binary, 10000);
+
+  // Destroying an unfinished copy aborts it
+  {
+    auto copy = sql::copy_into(db, tab).columns(tab.alpha);
+    copy.add(tab.alpha = 1);
+    assert_throw(copy.add(tab.alpha = sqlpp::default_value), sqlpp::exception);
+  }
+  assert(db(sqlpp::select(sqlpp::count(tab.alpha)).from(tab).unconditionally()).front().count.value() == 10001);
+
+  // Errors are reported when the copy is finished
+  {
+    auto copy = sql::copy_into(db, tab).columns(tab.beta);
+    copy.add(tab.beta = 1);
+    assert_throw(copy.finish(), sql::not_null_violation);
+  }
+
+  // Binary format needs exactly matching values
+  {
+    auto options = sql::copy_options{};
+    options.format = sql::copy_format::binary;
+    auto copy = sql::copy_into(db, tab, options).columns(tab.alpha, tab.beta);
+    assert_throw(copy.add(tab.alpha = 1, tab.beta = 100000), sqlpp::exception);
+  }
+
+  // A row with a field that cannot be written is dropped, the copy can be continued
+  for (const auto format : {sql::copy_format::text, sql::copy_format::binary})
+  {
+    recreate_table(db);
+    auto options = sql::copy_options{};
+    options.format = format;
+    auto copy = sql::copy_into(db, tab, options).columns(tab.alpha, tab.beta, tab.gamma);
+    copy.add(tab.alpha = 1, tab.beta = 1, tab.gamma = "first");
+    assert_throw(copy.add(tab.alpha = 2, tab.beta = 2, tab.gamma = sqlpp::default_value), sqlpp::exception);
+    copy.add(tab.alpha = 3, tab.beta = 3, tab.gamma = "third");
+    assert(copy.finish() == 2);
+    auto rows = db(sqlpp::select(tab.alpha, tab.gamma).from(tab).where(tab.alpha == 3));
+    assert(rows.front().gamma.value() == "third");
+  }
+
+  return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2013 - 2015, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <cassert>
+#include <iostream>
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include "TabFoo.h"
+#include "assertThrow.h"
+#include "make_test_connection.h"
+
+namespace sql = sqlpp::postgresql;
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  model::TabFoo tab = {};
+
+  const auto day = sqlpp::chrono::day_point{::date::year{2016} / 2 / 29};
+  const auto timepoint = sqlpp::chrono::microsecond_point{day + std::chrono::hours{13} + std::chrono::microseconds{17}};
+  const auto text = std::string{"tab\tnewline\nbackslash\\ carriage return\r"};
+
+  // beta_type decides the format: numeric cannot be decoded from binary, so the export falls back to text
+  void fill_table(sql::connection& db, const std::string& beta_type, int row_count)
+  {
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+               (
+                 alpha bigint NOT NULL,
+                 beta )" + beta_type + R"(,
+                 gamma text,
+                 c_bool boolean,
+                 c_timepoint timestamp with time zone,
+                 c_day date
+               ))");
+    auto copy = sql::copy_into(db, tab).columns(tab.alpha, tab.beta, tab.gamma, tab.c_bool, tab.c_timepoint, tab.c_day);
+    for (int i = 0; i < row_count; ++i)
+    {
+      copy.add(tab.alpha = i, tab.beta = i % 100, tab.gamma = text, tab.c_bool = (i % 2 == 0),
+               tab.c_timepoint = timepoint, tab.c_day = day);
+    }
+    copy.add(tab.alpha = row_count, tab.beta = sqlpp::null, tab.gamma = sqlpp::null, tab.c_bool = sqlpp::null,
+             tab.c_timepoint = sqlpp::null, tab.c_day = sqlpp::null);
+    copy.finish();
+  }
+
+  void test_copy_out(sql::connection& db, const std::string& beta_type, int row_count)
+  {
+    fill_table(db, beta_type, row_count);
+
+    int i = 0;
+    for (const auto& row :
+         sql::copy_out(db, sqlpp::select(all_of(tab)).from(tab).unconditionally().order_by(tab.alpha.asc())))
+    {
+      assert(row.alpha.value() == i);
+      if (i < row_count)
+      {
+        assert(row.beta.value() == i % 100);
+        assert(row.gamma.value() == text);
+        assert(row.c_bool.value() == (i % 2 == 0));
+        assert(row.c_timepoint.value() == timepoint);
+        assert(row.c_day.value() == day);
+      }
+      else
+      {
+        assert(row.beta.is_null());
+        assert(row.gamma.is_null());
+        assert(row.c_bool.is_null());
+        assert(row.c_timepoint.is_null());
+        assert(row.c_day.is_null());
+      }
+      ++i;
+    }
+    assert(i == row_count + 1);
+    // The connection is usable again once all rows have been read
+    db.execute("SELECT 1");
+  }
+}  // namespace
+
+int CopyOut(int, char*[])
+{
+  sql::connection db = sql::make_test_connection();
+
+  test_copy_out(db, "smallint", 10000);  // binary
+  test_copy_out(db, "numeric", 10000);   // text
+
+  // The connection cannot be used for anything else until the rows have been read
+  {
+    auto result = sql::copy_out(db, sqlpp::select(tab.alpha).from(tab).unconditionally());
+    assert(not result.empty());
+    assert_throw(db.execute("SELECT 1"), sqlpp::exception);
+  }
+  // Destroying the result stops the copy
+  db.execute("SELECT 1");
+
+  // Errors are reported as exceptions
+  assert_throw(sql::copy_out(db, sqlpp::select(tab.alpha).from(tab).where(tab.alpha / 0 == 1)), sqlpp::exception);
+  db.execute("SELECT 1");
+
+  return 0;
+}
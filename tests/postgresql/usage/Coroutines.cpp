@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cassert>
+#include <memory>
+#include <vector>
+
+#include <sqlpp11/postgresql/epoll_loop.h>
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include "TabFoo.h"
+#include "make_test_connection.h"
+
+#if SQLPP_CXX_STD >= 202002L && defined(__linux__)
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  model::TabFoo tab = {};
+
+  // Inserts rows, one statement at a time, and reads them back
+  sql::task insert_and_count(sql::async_executor& executor, int64_t first, int64_t row_count, int64_t& counted)
+  {
+    for (auto alpha = first; alpha < first + row_count; ++alpha)
+    {
+      const auto inserted = co_await executor(insert_into(tab).set(tab.alpha = alpha, tab.gamma = "coroutine"));
+      assert(inserted == 1);
+    }
+    auto rows = co_await executor(select(sqlpp::count(tab.alpha))
+                                      .from(tab)
+                                      .where(tab.alpha >= first and tab.alpha < first + row_count));
+    counted = rows.front().count;
+  }
+
+  sql::task insert_duplicate(sql::async_executor& executor)
+  {
+    co_await executor(insert_into(tab).set(tab.alpha = 0));
+  }
+}  // namespace
+
+int Coroutines(int, char*[])
+{
+  {
+    sql::connection db = sql::make_test_connection();
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+               (
+                 alpha bigint PRIMARY KEY,
+                 beta smallint,
+                 gamma text,
+                 c_bool boolean,
+                 c_timepoint timestamp with time zone,
+                 c_day date
+               ))");
+  }
+
+  // Several connections, served by a single thread
+  const auto connection_count = 8;
+  const auto row_count = 50;
+  // The executors refer to the connections, which must not be moved
+  std::vector<sql::connection> connections;
+  connections.reserve(connection_count);
+  std::vector<std::unique_ptr<sql::async_executor>> executors;
+  sql::epoll_loop loop;
+  for (int i = 0; i < connection_count; ++i)
+  {
+    connections.push_back(sql::make_test_connection());
+    executors.push_back(std::make_unique<sql::async_executor>(connections.back()));
+    loop.add(*executors.back());
+  }
+
+  std::vector<int64_t> counted(connection_count);
+  std::vector<sql::task> tasks;
+  for (int i = 0; i < connection_count; ++i)
+  {
+    tasks.push_back(insert_and_count(*executors[i], i * row_count, row_count, counted[i]));
+  }
+  loop.run();
+  for (int i = 0; i < connection_count; ++i)
+  {
+    assert(tasks[i].done());
+    tasks[i].get();
+    assert(counted[i] == row_count);
+  }
+
+  // Errors are thrown by co_await and end up in the task
+  auto failing = insert_duplicate(*executors.front());
+  loop.run();
+  assert(failing.done());
+  try
+  {
+    failing.get();
+    assert(false);
+  }
+  catch (const sql::unique_violation&)
+  {
+  }
+
+  for (auto& executor : executors)
+  {
+    loop.remove(*executor);
+  }
+  return 0;
+}
+#else
+int Coroutines(int, char*[])
+{
+  return 0;
+}
+#endif
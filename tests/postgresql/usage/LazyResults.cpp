@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2013 - 2015, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cassert>
+#include <iostream>
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include "TabFoo.h"
+#include "make_test_connection.h"
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  model::TabFoo tab = {};
+}  // namespace
+
+int LazyResults(int, char*[])
+{
+  auto config = sql::make_test_config();
+  config->lazy_results = true;
+  sql::connection db(config);
+  db.execute("SET TIME ZONE UTC;");
+
+  db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+  db.execute(R"(CREATE TABLE tabfoo
+             (
+               alpha bigserial NOT NULL,
+               beta smallint,
+               gamma text,
+               c_bool boolean,
+               c_timepoint timestamp with time zone,
+               c_day date
+             ))");
+
+  const auto day = sqlpp::chrono::day_point{::date::year{1999} / 12 / 31};
+  db(insert_into(tab).set(tab.beta = 17, tab.gamma = "cheesecake", tab.c_bool = true, tab.c_day = day));
+  db(insert_into(tab).default_values());
+
+  // Fields are parsed when they are accessed first
+  auto index = 0;
+  for (const auto& row : db(select(all_of(tab)).from(tab).unconditionally().order_by(tab.alpha.asc())))
+  {
+    assert(row.beta._pending_bind);
+    assert(row.c_day._pending_bind);
+    if (index == 0)
+    {
+      assert(row.beta.value() == 17);
+      assert(row.gamma == "cheesecake");
+      assert(row.c_day.value() == day);
+    }
+    else
+    {
+      assert(row.beta.is_null());
+      assert(row.gamma.is_null());
+      assert(row.c_day.is_null());
+    }
+    assert(not row.beta._pending_bind);
+    assert(row.c_timepoint._pending_bind);  // never read
+    ++index;
+  }
+  assert(index == 2);
+
+  // Prepared statements and moved results
+  auto prepared = db.prepare(select(all_of(tab)).from(tab).where(tab.alpha == parameter(tab.alpha)));
+  prepared.params.alpha = 1;
+  auto result = db(prepared);
+  auto moved = std::move(result);
+  assert(moved.front().gamma.value() == "cheesecake");
+  assert(moved.front().c_bool.value() == true);
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2013 - 2015, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cassert>
+#include <iostream>
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include "TabFoo.h"
+#include "make_test_connection.h"
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  model::TabFoo tab = {};
+
+  void test_list_parameter(sql::connection& db)
+  {
+    const auto names = std::vector<std::string>{"plain", "it's", "\"quoted\"", "back\\slash", "{braces}", "NULL", ""};
+    for (const auto& name : names)
+    {
+      db(insert_into(tab).set(tab.gamma = name));
+    }
+
+    // One statement for lists of any length
+    auto by_alpha = db.prepare(select(tab.gamma)
+                                   .from(tab)
+                                   .where(tab.alpha.in(sqlpp::list_parameter(tab.alpha)))
+                                   .order_by(tab.alpha.asc()));
+    for (size_t size = 0; size <= names.size(); ++size)
+    {
+      auto alphas = std::vector<int64_t>{};
+      for (size_t i = 0; i < size; ++i)
+      {
+        alphas.push_back(static_cast<int64_t>(i + 1));
+      }
+      by_alpha.params.alpha = alphas;
+      auto count = size_t{0};
+      for (const auto& row : db(by_alpha))
+      {
+        assert(row.gamma.value() == names[count]);
+        ++count;
+      }
+      assert(count == size);
+    }
+
+    // Text values are compared as they are
+    auto by_gamma = db.prepare(select(tab.alpha).from(tab).where(tab.gamma.in(sqlpp::list_parameter(tab.gamma))));
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+      by_gamma.params.gamma = std::vector<std::string>{"unknown", names[i]};
+      auto result = db(by_gamma);
+      assert(result.front().alpha.value() == static_cast<int64_t>(i + 1));
+      result.pop_front();
+      assert(result.empty());
+    }
+
+    auto excluded = db.prepare(select(tab.alpha).from(tab).where(tab.alpha.not_in(sqlpp::list_parameter(tab.alpha))));
+    excluded.params.alpha = std::vector<int>{1, 2, 3, 4, 5, 6};
+    assert(db(excluded).front().alpha.value() == 7);
+  }
+}  // namespace
+
+int ListParameter(int, char*[])
+{
+  for (const auto binary_format : {false, true})
+  {
+    auto config = sql::make_test_config();
+    config->binary_format = binary_format;
+    sql::connection db(config);
+
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+               (
+                 alpha bigserial NOT NULL,
+                 beta smallint,
+                 gamma text,
+                 c_bool boolean,
+                 c_timepoint timestamp with time zone,
+                 c_day date
+               ))");
+    test_list_parameter(db);
+  }
+
+  return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2013 - 2015, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cassert>
+#include <iostream>
+#include <limits>
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include "TabFoo.h"
+#include "make_test_connection.h"
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  model::TabFoo tab = {};
+}  // namespace
+
+int ParameterizeLiterals(int, char*[])
+{
+  auto config = sql::make_test_config();
+  config->statement_cache_size = 10;
+  config->parameterize_literals = true;
+  sql::connection db(config);
+  db.execute("SET TIME ZONE UTC;");
+
+  db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+  db.execute(R"(CREATE TABLE tabfoo
+             (
+               alpha bigserial NOT NULL,
+               beta smallint,
+               gamma text,
+               c_bool boolean,
+               c_timepoint timestamp with time zone,
+               c_day date
+             ))");
+
+  const auto day = sqlpp::chrono::day_point{::date::year{1999} / 12 / 31};
+
+  // Inserts with different values share one prepared statement
+  for (int i = 0; i < 10; ++i)
+  {
+    db(insert_into(tab).set(tab.beta = i, tab.gamma = "it's " + std::to_string(i), tab.c_bool = (i % 2 == 0),
+                            tab.c_day = day));
+  }
+  assert(db.get_statement_cache_stats().hits == 9);
+  assert(db.get_statement_cache_stats().misses == 1);
+
+  // So do selects, the text values are bound as they are, quotes included
+  for (int i = 0; i < 10; ++i)
+  {
+    auto result = db(select(tab.beta, tab.c_day).from(tab).where(tab.gamma == "it's " + std::to_string(i)));
+    const auto& row = result.front();
+    assert(row.beta.value() == i);
+    assert(row.c_day.value() == day);
+  }
+  assert(db.get_statement_cache_stats().hits == 18);
+  assert(db.get_statement_cache_stats().misses == 2);
+
+  // Sort orders remain part of the text
+  assert(db(select(tab.beta).from(tab).where(tab.c_bool == true).order_by(tab.beta.desc())).front().beta.value() == 8);
+  assert(db(update(tab).set(tab.c_bool = false).where(tab.beta > 5)) == 4);
+  assert(db(remove_from(tab).where(tab.beta == 0)) == 1);
+
+  // Unsigned values beyond int64_t are not bound, they are written as text like without the setting
+  const auto huge = std::numeric_limits<uint64_t>::max();
+  auto count = 0;
+  for (const auto& row : db(select(tab.beta).from(tab).where(tab.alpha < huge)))
+  {
+    assert(not row.beta.is_null());
+    ++count;
+  }
+  assert(count == 9);
+
+  return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2013 - 2015, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <cassert>
+#include <iostream>
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include "TabFoo.h"
+#include "assertThrow.h"
+#include "make_test_connection.h"
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  model::TabFoo tab = {};
+
+  int64_t count_rows(sql::connection& db)
+  {
+    return db(sqlpp::select(sqlpp::count(tab.alpha)).from(tab).unconditionally()).front().count;
+  }
+}  // namespace
+
+int Pipeline(int, char*[])
+{
+  sql::connection db = sql::make_test_connection();
+
+  db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+  db.execute(R"(CREATE TABLE tabfoo
+             (
+               alpha bigint PRIMARY KEY,
+               beta smallint,
+               gamma text,
+               c_bool boolean,
+               c_timepoint timestamp with time zone,
+               c_day date
+             ))");
+
+  auto insert = db.prepare(insert_into(tab).set(tab.alpha = parameter(tab.alpha), tab.gamma = parameter(tab.gamma)));
+  const auto row_count = 5000;
+  {
+    // Fewer results may be left unread than statements are queued
+    sql::pipeline pipeline{db, 100};
+    for (int i = 0; i < row_count; ++i)
+    {
+      insert.params.alpha = i;
+      insert.params.gamma = "pipelined";
+      pipeline(insert);
+      assert(pipeline.pending() <= 100);
+    }
+    // Other statements are rejected while the pipeline exists
+    assert_throw(db(insert_into(tab).default_values()), sqlpp::exception);
+
+    const auto results = pipeline.sync();
+    assert(results.size() == row_count);
+    for (const auto& result : results)
+    {
+      assert(result);
+      assert(result.affected_rows == 1);
+    }
+    assert(pipeline.sync().empty());
+  }
+  assert(count_rows(db) == row_count);
+
+  // A failing statement skips the remaining ones up to the next sync
+  {
+    sql::pipeline pipeline{db};
+    for (int i = row_count - 2; i < row_count + 3; ++i)
+    {
+      insert.params.alpha = i;
+      pipeline(insert);
+    }
+    const auto results = pipeline.sync();
+    assert(results.size() == 5);
+    try
+    {
+      std::rethrow_exception(results.front().error);
+    }
+    catch (const sql::unique_violation&)
+    {
+    }
+    for (const auto& result : results)
+    {
+      assert(not result);
+    }
+
+    insert.params.alpha = row_count;
+    pipeline(insert);
+    assert(pipeline.sync().front());
+  }
+  assert(count_rows(db) == row_count + 1);
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2013 - 2015, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  constexpr int row_count = 250 * 1000;
+  constexpr int field_count = 4;  // two bigint and two double precision columns
+
+  // Builds a result like the server would send it in text format, no connection required
+  PGresult* make_numeric_result()
+  {
+    PGresult* result = PQmakeEmptyPGresult(nullptr, PGRES_TUPLES_OK);
+    std::vector<PGresAttDesc> attributes(field_count);
+    const char* names[field_count] = {"small", "large", "price", "ratio"};
+    for (int field = 0; field < field_count; ++field)
+    {
+      attributes[field].name = const_cast<char*>(names[field]);
+      attributes[field].typid = field < 2 ? 20 : 701;
+      attributes[field].typlen = 8;
+      attributes[field].atttypmod = -1;
+    }
+    PQsetResultAttrs(result, field_count, attributes.data());
+
+    for (int row = 0; row < row_count; ++row)
+    {
+      const std::string values[field_count] = {std::to_string(row % 1000),
+                                               std::to_string(int64_t{1234567890123} * row - 987654321),
+                                               std::to_string(row % 100000) + "." + std::to_string(row % 100),
+                                               "-" + std::to_string(row) + ".0001220703125"};
+      for (int field = 0; field < field_count; ++field)
+      {
+        PQsetvalue(result, row, field, const_cast<char*>(values[field].c_str()), static_cast<int>(values[field].size()));
+      }
+    }
+    return result;
+  }
+
+  template <typename Decode>
+  double benchmark(const std::string& name, Decode decode)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    auto checksum = 0.0;
+    for (int row = 0; row < row_count; ++row)
+    {
+      checksum += decode(row);
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / (row_count * field_count)
+              << " ns per cell" << std::endl;
+    return checksum;
+  }
+}  // namespace
+
+int ResultBenchmark(int, char*[])
+{
+  sql::Result result;
+  result = make_numeric_result();
+
+  // What the accessors used to do
+  const auto expected = benchmark("std::stoll/std::stod", [&result](int row) {
+    return static_cast<double>(std::stoll(std::string{result.get_char_ptr_value(row, 0)})) +
+           static_cast<double>(std::stoll(std::string{result.get_char_ptr_value(row, 1)})) +
+           std::stod(std::string{result.get_char_ptr_value(row, 2)}) +
+           std::stod(std::string{result.get_char_ptr_value(row, 3)});
+  });
+
+  const auto checksum = benchmark("Result accessors", [&result](int row) {
+    return static_cast<double>(result.get_int64_value(row, 0)) + static_cast<double>(result.get_int64_value(row, 1)) +
+           result.get_double_value(row, 2) + result.get_double_value(row, 3);
+  });
+
+  if (checksum != expected)
+  {
+    std::cerr << "Checksum mismatch: " << checksum << " != " << expected << std::endl;
+    return 1;
+  }
+  return 0;
+}
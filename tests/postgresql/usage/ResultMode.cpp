@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2013 - 2015, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cassert>
+#include <iostream>
+#include <utility>
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include "TabFoo.h"
+#include "assertThrow.h"
+#include "make_test_connection.h"
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  model::TabFoo tab = {};
+
+  void testStreamedSelect(sql::connection& db, int expectedRowCount)
+  {
+    int i = 0;
+    for (const auto& row : db(sqlpp::select(all_of(tab)).from(tab).order_by(tab.alpha.asc()).unconditionally()))
+    {
+      ++i;
+      assert(i == row.alpha.value());
+    }
+    assert(i == expectedRowCount);
+
+    auto preparedSelectAll = db.prepare(sqlpp::select(all_of(tab)).from(tab).order_by(tab.alpha.asc()).unconditionally());
+    i = 0;
+    for (const auto& row : db(preparedSelectAll))
+    {
+      ++i;
+      assert(i == row.alpha.value());
+    }
+    assert(i == expectedRowCount);
+  }
+}  // namespace
+
+int ResultMode(int, char*[])
+{
+  sql::connection db = sql::make_test_connection();
+
+  db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+  db.execute(R"(CREATE TABLE tabfoo
+             (
+               alpha bigserial NOT NULL,
+               beta smallint,
+               gamma text,
+               c_bool boolean,
+               c_timepoint timestamp with time zone,
+               c_day date
+             ))");
+
+  db.set_result_mode(sql::result_mode::single_row);
+  assert(db.get_result_mode() == sql::result_mode::single_row);
+
+  testStreamedSelect(db, 0);
+  for (int i = 0; i < 100; ++i)
+  {
+    db(insert_into(tab).set(tab.gamma = "streamed"));
+  }
+  testStreamedSelect(db, 100);
+
+  {
+    // Other statements are rejected while a result is being streamed
+    auto result = db(sqlpp::select(all_of(tab)).from(tab).unconditionally());
+    assert(not result.empty());
+    assert_throw(db(insert_into(tab).default_values()), sqlpp::exception);
+    assert_throw(result.size(), sqlpp::exception);
+    // Destroying the partially read result cancels the query
+  }
+  db(insert_into(tab).default_values());
+  testStreamedSelect(db, 101);
+
+  {
+    // The same holds for results of prepared statements, which share their handle with the statement
+    auto prepared = db.prepare(sqlpp::select(all_of(tab)).from(tab).unconditionally());
+    for (const auto& row : db(prepared))
+    {
+      assert(not row.alpha.is_null());
+      break;
+    }
+    db.execute("SELECT 1");
+    auto count = 0;
+    for (const auto& row : db(prepared))
+    {
+      assert(not row.alpha.is_null());
+      ++count;
+    }
+    assert(count == 101);
+
+    // An older result does not cancel the query of a newer one
+    auto first = db(prepared);
+    while (not first.empty())
+    {
+      first.pop_front();
+    }
+    auto second = db(prepared);
+    first = std::move(second);
+    assert(not first.empty());
+  }
+
+  // Errors in the statement are reported when the query is executed
+  assert_throw(db.execute("SELECT * FROM tabfoo_does_not_exist"), sql::undefined_table);
+  // Errors in the rows are only reported while the result is read
+  {
+    const auto read_all = [&db]()
+    {
+      for (const auto& row :
+           db(sqlpp::select(sqlpp::verbatim<sqlpp::integer>("1/(alpha - 50)").as(tab.beta)).from(tab).unconditionally()))
+      {
+        assert(not row.beta.is_null());
+      }
+    };
+    assert_throw(read_all(), sql::data_exception);
+  }
+  // The connection can be used again afterwards
+  testStreamedSelect(db, 101);
+  db(insert_into(tab).default_values());
+
+  db.set_result_mode(sql::result_mode::buffered);
+  testStreamedSelect(db, 102);
+
+  return 0;
+}
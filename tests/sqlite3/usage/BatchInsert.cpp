@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "TabSample.h"
+#include <sqlpp11/aggregate_functions/count.h>
+#include <sqlpp11/insert.h>
+#include <sqlpp11/select.h>
+#include <sqlpp11/sqlite3/connection.h>
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace
+{
+  const auto tab = TabSample{};
+}  // namespace
+
+int BatchInsert(int, char*[])
+{
+  sql::connection db({":memory:", SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE});
+  db.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255) UNIQUE, gamma bool)");
+
+  auto batch = db.prepare(insert_into(tab).columns(tab.beta, tab.gamma).batch(4));
+  assert(batch.batch_size() == 4);
+
+  // Two full batches and a shorter one
+  for (int i = 0; i < 10; ++i)
+  {
+    if (i == 3)
+      batch.add(tab.beta = sqlpp::null, tab.gamma = false);
+    else
+      batch.add(tab.beta = std::to_string(i), tab.gamma = i % 2 == 0);
+  }
+  assert(batch.size() == 10);
+  assert(db(batch) == 10);
+  assert(batch.size() == 0);
+
+  // Default values cannot be bound as parameters
+  try
+  {
+    batch.add(tab.beta = sqlpp::default_value, tab.gamma = true);
+    assert(false);
+  }
+  catch (const sqlpp::exception&)
+  {
+  }
+  assert(batch.size() == 0);
+
+  // Running an empty batch does nothing
+  assert(db(batch) == 0);
+
+  // The statement for the remaining rows is reused if the number of rows matches, and replaced otherwise
+  for (int i = 10; i < 16; ++i)
+  {
+    batch.add(tab.beta = std::to_string(i), tab.gamma = true);
+  }
+  assert(db(batch) == 6);
+  batch.add(tab.beta = "16", tab.gamma = true);
+  assert(db(batch) == 1);
+
+  int64_t expected = 0;
+  for (const auto& row : db(select(all_of(tab)).from(tab).order_by(tab.alpha.asc()).unconditionally()))
+  {
+    ++expected;
+    assert(row.alpha.value() == expected);
+    if (expected == 4)
+    {
+      assert(row.beta.is_null());
+      assert(row.gamma.value() == false);
+    }
+    else
+    {
+      assert(row.beta.value() == std::to_string(expected - 1));
+      assert(row.gamma.value() == (expected > 10 or expected % 2 == 1));
+    }
+  }
+  assert(expected == 17);
+
+  // If an execution fails, the rows of the preceding executions are not kept for the next run
+  batch.add(tab.beta = "17", tab.gamma = true);
+  batch.add(tab.beta = "18", tab.gamma = true);
+  batch.add(tab.beta = "19", tab.gamma = true);
+  batch.add(tab.beta = "20", tab.gamma = true);
+  batch.add(tab.beta = "0", tab.gamma = true);  // duplicate
+  batch.add(tab.beta = "21", tab.gamma = true);
+  try
+  {
+    db(batch);
+    assert(false);
+  }
+  catch (const sqlpp::exception&)
+  {
+  }
+  assert(batch.size() == 2);
+  batch.clear();
+  batch.add(tab.beta = "21", tab.gamma = true);
+  assert(db(batch) == 1);
+  assert(db(select(sqlpp::count(tab.alpha)).from(tab).unconditionally()).front().count.value() == 22);
+
+  return 0;
+}
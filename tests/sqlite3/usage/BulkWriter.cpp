@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "TabSample.h"
+
+#include "TabSample.h"
+#include <sqlpp11/aggregate_functions/count.h>
+#include <sqlpp11/insert.h>
+#include <sqlpp11/parameter.h>
+#include <sqlpp11/select.h>
+#include <sqlpp11/sqlite3/bulk_writer.h>
+#include <sqlpp11/sqlite3/connection.h>
+
+#include <cassert>
+#include <string>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace
+{
+  const auto tab = TabSample{};
+
+  size_t count_rows(sql::connection& db)
+  {
+    return static_cast<size_t>(db(select(sqlpp::count(tab.alpha)).from(tab).unconditionally()).front().count);
+  }
+}  // namespace
+
+int BulkWriter(int, char*[])
+{
+  sql::connection db({":memory:", SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE});
+  db.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+
+  const auto insert = insert_into(tab).set(tab.beta = parameter(tab.beta), tab.gamma = parameter(tab.gamma));
+
+  // Rows are committed every rows_per_transaction rows and by finish()
+  {
+    auto writer = sql::make_bulk_writer(db, insert, {4});
+    for (int i = 0; i < 10; ++i)
+    {
+      writer.params().beta = std::to_string(i);
+      writer.params().gamma = i % 2 == 0;
+      writer.write();
+      assert(db.is_transaction_active() == ((i + 1) % 4 != 0));
+    }
+    writer.finish();
+    assert(not db.is_transaction_active());
+    assert(writer.stats().rows == 10);
+    assert(writer.stats().transactions == 3);
+    assert(writer.stats().rows_per_second() > 0);
+  }
+  assert(count_rows(db) == 10);
+
+  // Rows written after the last commit are rolled back if finish() is not called
+  {
+    auto writer = sql::make_bulk_writer(db, insert, {4});
+    for (int i = 0; i < 6; ++i)
+    {
+      writer.params().beta = std::to_string(i);
+      writer.params().gamma = true;
+      writer.write();
+    }
+  }
+  assert(not db.is_transaction_active());
+  assert(count_rows(db) == 14);
+
+  // Inside an existing transaction, the writer does not start or commit transactions
+  {
+    db.start_transaction();
+    auto writer = sql::make_bulk_writer(db, insert, {2});
+    for (int i = 0; i < 5; ++i)
+    {
+      writer.params().beta = std::to_string(i);
+      writer.params().gamma = false;
+      writer.write();
+    }
+    writer.finish();
+    assert(writer.stats().transactions == 0);
+    assert(db.is_transaction_active());
+    db.rollback_transaction(false);
+  }
+  assert(count_rows(db) == 14);
+
+  // If the commit fails, the rows are rolled back by the destructor
+  db.execute("PRAGMA foreign_keys = ON");
+  db.execute("CREATE TABLE parent (id INTEGER PRIMARY KEY)");
+  db.execute("CREATE TABLE child (parent_id INTEGER REFERENCES parent(id) DEFERRABLE INITIALLY DEFERRED)");
+  {
+    auto writer = sql::make_bulk_writer(db, insert, {10});
+    writer.params().beta = "orphan";
+    writer.params().gamma = true;
+    writer.write();
+    db.execute("INSERT INTO child VALUES (42)");
+    try
+    {
+      writer.finish();
+      assert(false);
+    }
+    catch (const sqlpp::exception&)
+    {
+    }
+    assert(db.is_transaction_active());
+  }
+  assert(not db.is_transaction_active());
+  assert(count_rows(db) == 14);
+
+  // The cached transaction statements remain usable for ordinary transactions
+  db.start_transaction();
+  db(insert_into(tab).set(tab.beta = "last", tab.gamma = true));
+  db.commit_transaction();
+  assert(count_rows(db) == 15);
+
+  return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "TabSample.h"
+
+#include "TabSample.h"
+#include <sqlpp11/sqlite3/sqlite3.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace
+{
+  const auto tab = TabSample{};
+
+  // A file based database, since commits to an in-memory database are almost free
+  const auto database = std::string{"bulk_writer_benchmark.db"};
+
+  sql::connection open_database()
+  {
+    std::remove(database.c_str());
+    sql::connection db({database, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE});
+    db.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+    return db;
+  }
+
+  void report(const std::string& name, size_t rows, std::chrono::steady_clock::duration elapsed)
+  {
+    const auto seconds = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed).count();
+    std::cout << name << ": " << rows << " rows in " << seconds << "s, " << (rows / seconds) << " rows/s\n";
+  }
+}  // namespace
+
+int BulkWriterBenchmark(int, char*[])
+{
+  try
+  {
+    const auto rows = size_t{2000};
+
+    // One unprepared insert and one implicit transaction per row
+    {
+      auto db = open_database();
+      const auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < rows; ++i)
+      {
+        db(insert_into(tab).set(tab.beta = std::to_string(i), tab.gamma = true));
+      }
+      report("naive loop", rows, std::chrono::steady_clock::now() - start);
+    }
+
+    // One prepared insert, committed every 1000 rows
+    {
+      auto db = open_database();
+      auto writer = sql::make_bulk_writer(
+          db, insert_into(tab).set(tab.beta = parameter(tab.beta), tab.gamma = parameter(tab.gamma)), {1000});
+      for (size_t i = 0; i < rows; ++i)
+      {
+        writer.params().beta = std::to_string(i);
+        writer.params().gamma = true;
+        writer.write();
+      }
+      writer.finish();
+      report("bulk writer", writer.stats().rows, writer.stats().elapsed);
+    }
+    std::remove(database.c_str());
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,63 @@
+/*
+Copyright (c) 2023, Vesselin Atanasov
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice, this
+   list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp11/sqlite3/sqlite3.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include "../../include/ConnectionPoolTests.h"
+
+namespace sql = ::sqlpp::sqlite3;
+
+int ConnectionPoolBenchmark(int, char*[])
+{
+  if (not sqlite3_threadsafe())
+  {
+    return 0;
+  }
+  try
+  {
+    auto config = std::make_shared<sql::connection_config>();
+    config->path_to_database = ":memory:";
+    config->flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
+
+    const auto thread_count = std::max(4u, std::thread::hardware_concurrency());
+    const auto iterations = std::size_t{20000};
+
+    // Single lock for all idle connections
+    auto options = sqlpp::connection_pool_options{};
+    sqlpp::test::benchmark_connection_pool<sql::connection_pool>(config, options, thread_count, iterations);
+
+    // One lock per shard of idle connections
+    options.shards = thread_count;
+    sqlpp::test::benchmark_connection_pool<sql::connection_pool>(config, options, thread_count, iterations);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "TabSample.h"
+
+#include <sqlpp11/alias_provider.h>
+#include <sqlpp11/custom_query.h>
+#include <sqlpp11/select.h>
+#include <sqlpp11/verbatim.h>
+#include <sqlpp11/sqlite3/connection.h>
+#include <sqlpp11/sqlite3/connection_pool.h>
+
+#include <cassert>
+#include <cstdio>
+#include <string>
+
+namespace sql = sqlpp::sqlite3;
+
+SQLPP_ALIAS_PROVIDER(pragma)
+
+namespace
+{
+  template <typename Db>
+  int64_t integer_pragma(Db& db, const std::string& name)
+  {
+    return db(sqlpp::custom_query(sqlpp::verbatim("PRAGMA " + name)).with_result_type_of(select(sqlpp::value(1).as(pragma))))
+        .front()
+        .pragma;
+  }
+
+  template <typename Db>
+  std::string text_pragma(Db& db, const std::string& name)
+  {
+    return db(sqlpp::custom_query(sqlpp::verbatim("PRAGMA " + name)).with_result_type_of(select(sqlpp::value("").as(pragma))))
+        .front()
+        .pragma;
+  }
+}  // namespace
+
+int ConnectionSettings(int, char*[])
+{
+  const auto database = std::string{"connection_settings.db"};
+  std::remove(database.c_str());
+  std::remove((database + "-wal").c_str());
+  std::remove((database + "-shm").c_str());
+
+  auto config = std::make_shared<sql::connection_config>();
+  config->path_to_database = database;
+  config->flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
+
+  // By default, the sqlite3 settings are left alone
+  {
+    sql::connection db(config);
+    assert(text_pragma(db, "journal_mode") == "delete");
+    assert(integer_pragma(db, "busy_timeout") == 0);
+  }
+  std::remove(database.c_str());
+
+  config->journal_mode = sql::connection_config::journal_mode_t::wal;
+  config->synchronous = sql::connection_config::synchronous_t::normal;
+  config->busy_timeout = 5000;
+  config->mmap_size = 1 << 20;
+  config->cache_size = -4096;
+  config->temp_store = sql::connection_config::temp_store_t::memory;
+  config->page_size = 8192;
+  {
+    sql::connection db(config);
+    assert(text_pragma(db, "journal_mode") == "wal");
+    assert(integer_pragma(db, "synchronous") == 1);
+    assert(integer_pragma(db, "busy_timeout") == 5000);
+    assert(integer_pragma(db, "cache_size") == -4096);
+    assert(integer_pragma(db, "temp_store") == 2);
+    assert(integer_pragma(db, "page_size") == 8192);
+    // Memory mapping might be disabled at compile time
+    assert(integer_pragma(db, "mmap_size") == (1 << 20) or integer_pragma(db, "mmap_size") == 0);
+  }
+
+  // Every pooled connection gets the settings
+  {
+    sql::connection_pool pool{config, 2};
+    auto first = pool.get();
+    auto second = pool.get();
+    assert(integer_pragma(first, "busy_timeout") == 5000);
+    assert(integer_pragma(second, "busy_timeout") == 5000);
+    assert(text_pragma(second, "journal_mode") == "wal");
+  }
+
+  // In-memory databases do not support WAL and keep their journal mode
+  config->path_to_database = ":memory:";
+  {
+    sql::connection db(config);
+    assert(text_pragma(db, "journal_mode") == "memory");
+  }
+
+  std::remove(database.c_str());
+  std::remove((database + "-wal").c_str());
+  std::remove((database + "-shm").c_str());
+  return 0;
+}
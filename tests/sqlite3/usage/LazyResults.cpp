@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabSample.h"
+#include <sqlpp11/insert.h>
+#include <sqlpp11/select.h>
+#include <sqlpp11/sqlite3/connection.h>
+
+#include <cassert>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace
+{
+  const auto tab = TabSample{};
+}  // namespace
+
+int LazyResults(int, char*[])
+{
+  auto config = sql::connection_config{":memory:", SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE};
+  config.lazy_results = true;
+  sql::connection db(config);
+  db.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+
+  db(insert_into(tab).set(tab.beta = "cheesecake", tab.gamma = true));
+  db(insert_into(tab).set(tab.beta = sqlpp::null, tab.gamma = false));
+  db(insert_into(tab).set(tab.beta = "cake", tab.gamma = true));
+
+  // Fields are read when they are accessed first, and only once per row
+  auto index = 0;
+  for (const auto& row : db(select(all_of(tab)).from(tab).unconditionally().order_by(tab.alpha.asc())))
+  {
+    assert(row.alpha._pending_bind);
+    assert(row.beta._pending_bind);
+    assert(row.gamma._pending_bind);
+    assert(row.alpha.value() == index + 1);
+    assert(not row.alpha._pending_bind);
+    if (index == 1)
+    {
+      assert(row.beta.is_null());
+      assert(row.beta.value() == "");
+    }
+    else
+    {
+      assert(not row.beta.is_null());
+      assert(row.beta == (index == 0 ? "cheesecake" : "cake"));
+    }
+    assert(not row.beta._pending_bind);
+    assert(row.gamma._pending_bind);  // never read
+    ++index;
+  }
+  assert(index == 3);
+
+  // Fields that have not been read yet follow their result when it is moved
+  {
+    auto result = db(select(all_of(tab)).from(tab).where(tab.alpha == 3));
+    auto moved = std::move(result);
+    assert(moved.front().beta.value() == "cake");
+    assert(moved.front().gamma.value() == true);
+    moved.pop_front();
+    assert(moved.empty());
+  }
+
+  // Copies of fields are read right away, so they stay valid when the result moves on
+  {
+    auto result = db(select(all_of(tab)).from(tab).unconditionally().order_by(tab.alpha.asc()));
+    auto it = result.begin();
+    auto alpha = (*it).alpha;
+    auto beta = (*it).beta;
+    assert(not alpha._pending_bind);
+    assert(not beta._pending_bind);
+    ++it;
+    assert(alpha.value() == 1);
+    assert(beta == "cheesecake");
+    alpha = (*it).alpha;
+    ++it;
+    assert(alpha.value() == 2);
+  }
+
+  // Lazy and zero copy results can be combined
+  config.zero_copy_results = true;
+  sql::connection viewing(config);
+  viewing.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+  viewing(insert_into(tab).set(tab.beta = "cheesecake", tab.gamma = true));
+  for (const auto& row : viewing(select(tab.beta).from(tab).unconditionally()))
+  {
+    assert(row.beta == "cheesecake");
+    assert(row.beta._is_view);
+  }
+
+  // Without lazy results, fields are read with the row
+  sql::connection eager({":memory:", SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE});
+  eager.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+  eager(insert_into(tab).set(tab.beta = "cheesecake", tab.gamma = true));
+  for (const auto& row : eager(select(all_of(tab)).from(tab).unconditionally()))
+  {
+    assert(not row.beta._pending_bind);
+    assert(row.beta._value == "cheesecake");
+  }
+
+  return 0;
+}
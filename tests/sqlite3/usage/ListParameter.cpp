@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabSample.h"
+#include <sqlpp11/insert.h>
+#include <sqlpp11/select.h>
+#include <sqlpp11/sqlite3/connection.h>
+
+#include <cassert>
+#include <vector>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace
+{
+  const auto tab = TabSample{};
+}  // namespace
+
+int ListParameter(int, char*[])
+{
+  auto config = sql::connection_config{":memory:", SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE};
+  config.statement_cache_size = 10;
+  sql::connection db(config);
+  db.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+
+  const auto names = std::vector<std::string>{"plain", "it's", "\"quoted\"", "back\\slash", "tab\there", ""};
+  for (const auto& name : names)
+  {
+    db(insert_into(tab).set(tab.beta = name, tab.gamma = true));
+  }
+
+  // One statement for lists of any length
+  auto by_alpha = db.prepare(select(tab.beta).from(tab).where(tab.alpha.in(sqlpp::list_parameter(tab.alpha))));
+  for (size_t size = 0; size <= names.size(); ++size)
+  {
+    auto alphas = std::vector<int64_t>{};
+    for (size_t i = 0; i < size; ++i)
+    {
+      alphas.push_back(static_cast<int64_t>(i + 1));
+    }
+    by_alpha.params.alpha = alphas;
+    auto count = size_t{0};
+    for (const auto& row : db(by_alpha))
+    {
+      assert(row.beta == names[count]);
+      ++count;
+    }
+    assert(count == size);
+  }
+
+  // Text values are compared as they are
+  auto by_beta = db.prepare(select(tab.alpha).from(tab).where(tab.beta.in(sqlpp::list_parameter(tab.beta))));
+  for (size_t i = 0; i < names.size(); ++i)
+  {
+    by_beta.params.beta = std::vector<std::string>{"unknown", names[i]};
+    auto result = db(by_beta);
+    assert(result.front().alpha.value() == static_cast<int64_t>(i + 1));
+    result.pop_front();
+    assert(result.empty());
+  }
+
+  auto excluded = db.prepare(select(tab.alpha).from(tab).where(tab.alpha.not_in(sqlpp::list_parameter(tab.alpha))));
+  excluded.params.alpha = std::vector<int>{1, 2, 3, 4, 5};
+  assert(db(excluded).front().alpha.value() == 6);
+
+  return 0;
+}
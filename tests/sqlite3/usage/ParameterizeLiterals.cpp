@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabSample.h"
+#include <sqlpp11/insert.h>
+#include <sqlpp11/remove.h>
+#include <sqlpp11/select.h>
+#include <sqlpp11/sqlite3/connection.h>
+#include <sqlpp11/update.h>
+
+#include <cassert>
+#include <iostream>
+#include <limits>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace
+{
+  const auto tab = TabSample{};
+
+  void assert_stats(const sqlpp::statement_cache_stats& stats, size_t hits, size_t misses)
+  {
+    if (stats.hits != hits or stats.misses != misses)
+    {
+      std::cerr << "Unexpected statement cache stats: hits = " << stats.hits << ", misses = " << stats.misses
+                << std::endl;
+      assert(false);
+    }
+  }
+}  // namespace
+
+int ParameterizeLiterals(int, char*[])
+{
+  auto config = sql::connection_config{":memory:", SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE};
+  config.statement_cache_size = 10;
+  config.parameterize_literals = true;
+  sql::connection db(config);
+  db.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+
+  // Inserts with different values share one prepared statement
+  for (int i = 0; i < 10; ++i)
+  {
+    db(insert_into(tab).set(tab.beta = "it's " + std::to_string(i), tab.gamma = (i % 2 == 0)));
+  }
+  assert_stats(db.get_statement_cache_stats(), 9, 1);
+
+  // So do selects, the text values are bound as they are, quotes included
+  for (int i = 0; i < 10; ++i)
+  {
+    auto count = 0;
+    for (const auto& row : db(select(tab.alpha, tab.beta).from(tab).where(tab.beta == "it's " + std::to_string(i))))
+    {
+      assert(row.alpha.value() == i + 1);
+      assert(row.beta == "it's " + std::to_string(i));
+      ++count;
+    }
+    assert(count == 1);
+  }
+  assert_stats(db.get_statement_cache_stats(), 18, 2);
+
+  // Results can be read after the statement (and its values) are gone
+  {
+    auto rows = db(select(tab.beta).from(tab).where(tab.beta > std::string{"it's 7"}).order_by(tab.beta.desc()));
+    assert(rows.front().beta == "it's 9");
+    rows.pop_front();
+    assert(rows.front().beta == "it's 8");
+  }
+  assert_stats(db.get_statement_cache_stats(), 18, 3);
+
+  // Sort orders remain part of the text
+  assert(db(select(tab.alpha).from(tab).unconditionally().order_by(tab.alpha.asc())).front().alpha.value() == 1);
+  assert(db(select(tab.alpha).from(tab).unconditionally().order_by(tab.alpha.desc())).front().alpha.value() == 10);
+  assert_stats(db.get_statement_cache_stats(), 18, 5);
+
+  // Updates and removes report the number of affected rows
+  assert(db(update(tab).set(tab.gamma = false).where(tab.alpha > 5)) == 5);
+  assert(db(update(tab).set(tab.gamma = false).where(tab.alpha > 8)) == 2);
+  assert(db(remove_from(tab).where(tab.alpha == 1)) == 1);
+  assert(db(remove_from(tab).where(tab.alpha == 2)) == 1);
+  assert_stats(db.get_statement_cache_stats(), 20, 7);
+
+  // Without the setting, statements are executed as text
+  {
+    sql::connection plain({":memory:", SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE});
+    plain.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+    plain(insert_into(tab).set(tab.beta = "it's", tab.gamma = true));
+    assert(plain(select(tab.beta).from(tab).where(tab.alpha == 1)).front().beta == "it's");
+    assert_stats(plain.get_statement_cache_stats(), 0, 0);
+
+    // Unsigned values beyond int64_t are not bound, they are written as text like without the setting
+    const auto huge = std::numeric_limits<uint64_t>::max();
+    assert(db(select(tab.alpha).from(tab).where(tab.alpha < huge)).empty() ==
+           plain(select(tab.alpha).from(tab).where(tab.alpha < huge)).empty());
+    auto rows = db(select(tab.alpha).from(tab).where(tab.alpha != huge).order_by(tab.alpha.asc()));
+    assert(rows.front().alpha.value() == 3);
+  }
+
+  return 0;
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabSample.h"
+#include <sqlpp11/insert.h>
+#include <sqlpp11/parameter.h>
+#include <sqlpp11/select.h>
+#include <sqlpp11/sqlite3/connection.h>
+#include <sqlpp11/sqlite3/connection_pool.h>
+
+#include <cassert>
+#include <iostream>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace
+{
+  const auto tab = TabSample{};
+
+  sql::connection_config make_config(const std::string& path, size_t cache_size)
+  {
+    auto config = sql::connection_config{path, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_URI};
+    config.statement_cache_size = cache_size;
+    return config;
+  }
+
+  void assert_stats(const sqlpp::statement_cache_stats& stats, size_t hits, size_t misses, size_t size)
+  {
+    if (stats.hits != hits or stats.misses != misses or stats.size != size)
+    {
+      std::cerr << "Unexpected statement cache stats: hits = " << stats.hits << ", misses = " << stats.misses
+                << ", size = " << stats.size << std::endl;
+      assert(false);
+    }
+  }
+}  // namespace
+
+int StatementCache(int, char*[])
+{
+  // The cache is disabled by default
+  {
+    sql::connection db({":memory:", SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE});
+    db.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+    auto first = db.prepare(select(tab.alpha).from(tab).unconditionally());
+    auto second = db.prepare(select(tab.alpha).from(tab).unconditionally());
+    assert(not(first._prepared_statement == second._prepared_statement));
+    assert_stats(db.get_statement_cache_stats(), 0, 0, 0);
+  }
+
+  sql::connection db(make_config(":memory:", 2));
+  db.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+  auto insert = insert_into(tab).set(tab.beta = parameter(tab.beta), tab.gamma = true);
+  for (int i = 0; i < 10; ++i)
+  {
+    auto prepared = db.prepare(insert);
+    prepared.params.beta = std::to_string(i);
+    db(prepared);
+  }
+  assert_stats(db.get_statement_cache_stats(), 9, 1, 1);
+
+  // A statement that is in use is not handed out twice
+  const auto s = select(tab.alpha, tab.beta).from(tab).where(tab.alpha > parameter(tab.alpha)).order_by(tab.alpha.asc());
+  {
+    auto first = db.prepare(s);
+    auto second = db.prepare(s);
+    assert(not(first._prepared_statement == second._prepared_statement));
+    first.params.alpha = 0;
+    second.params.alpha = 5;
+    auto first_rows = db(first);
+    auto second_rows = db(second);
+    assert(first_rows.front().alpha.value() == 1);
+    assert(second_rows.front().alpha.value() == 6);
+  }
+  assert_stats(db.get_statement_cache_stats(), 9, 3, 2);
+
+  // Results that have not been read completely do not affect the next user of the statement
+  {
+    auto prepared = db.prepare(s);
+    prepared.params.alpha = 0;
+    assert(db(prepared).front().alpha.value() == 1);
+  }
+  {
+    auto prepared = db.prepare(s);
+    prepared.params.alpha = 8;
+    auto count = 0;
+    for (const auto& row : db(prepared))
+    {
+      assert(row.alpha.value() > 8);
+      ++count;
+    }
+    assert(count == 2);
+  }
+  assert_stats(db.get_statement_cache_stats(), 11, 3, 2);
+
+  // The least recently used statement is evicted
+  db.prepare(select(tab.gamma).from(tab).unconditionally());
+  db.prepare(insert);
+  assert_stats(db.get_statement_cache_stats(), 11, 5, 2);
+
+  // The cache survives the connection's trip through the pool
+  {
+    sql::connection_pool pool{std::make_shared<sql::connection_config>(
+                                  make_config("file:statement_cache?mode=memory&cache=shared", 10)),
+                              1};
+    {
+      auto pooled = pool.get();
+      pooled.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+      pooled.prepare(select(tab.alpha).from(tab).unconditionally());
+    }
+    auto pooled = pool.get();
+    pooled.prepare(select(tab.alpha).from(tab).unconditionally());
+    assert_stats(pooled.get_statement_cache_stats(), 1, 1, 1);
+  }
+
+  return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "BlobSample.h"
+#include "TabSample.h"
+#include <sqlpp11/compat/sqlpp_cxx_std.h>
+#include <sqlpp11/insert.h>
+#include <sqlpp11/select.h>
+#include <sqlpp11/sqlite3/connection.h>
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace
+{
+  const auto tab = TabSample{};
+  const auto blob = BlobSample{};
+}  // namespace
+
+int ZeroCopyResults(int, char*[])
+{
+  auto config = sql::connection_config{":memory:", SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE};
+  config.zero_copy_results = true;
+  sql::connection db(config);
+  db.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+  db.execute("CREATE TABLE blob_sample (id INTEGER PRIMARY KEY, data blob)");
+
+  const auto long_text = std::string(10000, 'x');
+  db(insert_into(tab).set(tab.beta = "cheesecake", tab.gamma = true));
+  db(insert_into(tab).set(tab.beta = long_text, tab.gamma = true));
+  db(insert_into(tab).set(tab.beta = sqlpp::null, tab.gamma = false));
+
+  auto expected = std::vector<std::string>{"cheesecake", long_text, ""};
+  size_t index = 0;
+  for (const auto& row : db(select(tab.beta).from(tab).unconditionally().order_by(tab.alpha.asc())))
+  {
+    // The text is not copied into the field, value() makes a copy on demand
+    assert(row.beta._is_view);
+    assert(row.beta._value.empty());
+    assert(row.beta.is_null() == (index == 2));
+    assert(row.beta.value() == expected[index]);
+    assert(row.beta == expected[index]);
+    assert(std::string(row.beta) == expected[index]);
+    if (not row.beta.is_null())
+    {
+      assert(std::string(row.beta.text, row.beta.len) == expected[index]);
+    }
+    ++index;
+  }
+  assert(index == expected.size());
+
+  // Copies own their value and stay valid after the result advances
+  {
+    auto rows = db(select(tab.beta).from(tab).unconditionally().order_by(tab.alpha.asc()));
+    auto it = rows.begin();
+    auto first = (*it).beta;
+    assert(not first._is_view);
+    ++it;
+    auto second = (*it).beta;
+    second = (*it).beta;
+    ++it;
+    assert(first.value() == "cheesecake");
+    assert(second.value() == long_text);
+    assert(std::string(first.text, first.len) == "cheesecake");
+
+    // Moved copies point at their own value (short strings are stored inside the field)
+    auto fields = std::vector<decltype(first)>{};
+    fields.push_back(std::move(first));
+    fields.push_back(std::move(second));
+    fields.push_back(fields.front());
+    for (const auto& field : fields)
+    {
+      assert(field.text == field._value.data());
+      assert(std::string(field.text, field.len) == field.value());
+    }
+    auto moved = std::move(fields.front());
+    moved = std::move(fields.back());
+    assert(moved.text == moved._value.data());
+#if SQLPP_CXX_STD >= 201703L
+    assert(moved.view() == "cheesecake");
+    assert(fields[1].view() == long_text);
+#endif
+  }
+
+  const auto data = std::vector<uint8_t>{0, 1, 2, 255};
+  db(insert_into(blob).set(blob.data = data));
+  auto result = db(select(blob.data).from(blob).unconditionally());
+  const auto& row = result.front();
+  assert(row.data._is_view);
+  assert(row.data.value() == data);
+  assert(row.data == data);
+  auto copied_data = row.data;
+  assert(not copied_data._is_view);
+  assert(copied_data.value() == data);
+  auto moved_data = std::move(copied_data);
+  assert(moved_data.blob == moved_data._value.data());
+#if SQLPP_CXX_STD >= 202002L
+  assert(moved_data.view().size() == data.size());
+  assert(std::equal(data.begin(), data.end(), moved_data.view().begin()));
+#endif
+
+  // Without zero copy results, the fields own their values
+  sql::connection copying({":memory:", SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE});
+  copying.execute("CREATE TABLE tab_sample (alpha INTEGER PRIMARY KEY, beta varchar(255), gamma bool)");
+  copying(insert_into(tab).set(tab.beta = "cheesecake", tab.gamma = true));
+  for (const auto& copied : copying(select(tab.beta).from(tab).unconditionally()))
+  {
+    assert(not copied.beta._is_view);
+    assert(copied.beta._value == "cheesecake");
+  }
+
+  return 0;
+}